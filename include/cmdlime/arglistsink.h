@@ -0,0 +1,81 @@
+#ifndef CMDLIME_ARGLISTSINK_H
+#define CMDLIME_ARGLISTSINK_H
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace cmdlime {
+
+//argument list field that passes every read element to the handler instead of storing it,
+//the handler can be a function taking the element or an output iterator.
+//The elements are passed after the command line is scanned, in the command line order,
+//a ValidationError thrown by the handler is reported as the element's conversion error
+template<typename T>
+class ArgListSink {
+public:
+    using value_type = T;
+
+    ArgListSink() = default;
+
+    template<typename THandler, std::enable_if_t<std::is_invocable_v<THandler&, T&&>>* = nullptr>
+    ArgListSink(THandler handler)
+        : handler_{std::move(handler)}
+    {
+    }
+
+    template<
+            typename TOutputIt,
+            std::enable_if_t<
+                    !std::is_invocable_v<TOutputIt&, T&&> &&
+                    std::is_assignable_v<decltype(*std::declval<TOutputIt&>()), T&&>>* = nullptr>
+    ArgListSink(TOutputIt outputIt)
+        : handler_{[outputIt](T&& element) mutable
+                   {
+                       *outputIt++ = std::move(element);
+                   }}
+    {
+    }
+
+    void emplace_back(T element)
+    {
+        if (handler_)
+            handler_(std::move(element));
+        ++size_;
+    }
+
+    //the handler is kept, only the number of the passed elements is reset
+    void clear()
+    {
+        size_ = 0;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+private:
+    std::function<void(T&&)> handler_;
+    std::size_t size_ = 0;
+};
+
+namespace detail {
+
+template<typename T>
+struct isArgListSink : std::false_type {};
+
+template<typename T>
+struct isArgListSink<ArgListSink<T>> : std::true_type {};
+
+} //namespace detail
+
+} //namespace cmdlime
+
+#endif //CMDLIME_ARGLISTSINK_H
@@ -5,23 +5,38 @@
 #include "errors.h"
 #include "format.h"
 #include "postprocessor.h"
+#include "readresult.h"
 #include "usageinfoformat.h"
+#include "detail/commandlineview.h"
 #include "detail/configmacros.h"
 #include "detail/external/sfun/wstringconv.h"
 #include "detail/flag.h"
 #include "detail/formatcfg.h"
 #include "detail/nameformat.h"
+#include "detail/usageinfocache.h"
 #include "detail/usageinfocreator.h"
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace cmdlime {
+namespace detail {
+class CommandLineReaderAccess;
+}
 
 template<Format formatType = Format::GNU>
 class CommandLineReader : public detail::ICommandLineReader {
+    friend class detail::CommandLineReaderAccess;
+
 public:
     CommandLineReader(
             const std::string& programName = {},
@@ -36,40 +51,83 @@ public:
     template<typename TCfg>
     TCfg read(int argc, char** argv)
     {
-        return read<TCfg>(std::vector<std::string>{argv + 1, argv + argc});
+        return readCommandLine<TCfg>(detail::makeCommandLine(argc, argv));
     }
 
     template<typename TCfg>
     TCfg read(const std::vector<std::string>& cmdLine)
     {
+        return readCommandLine<TCfg>(detail::makeCommandLine(cmdLine));
+    }
+
+    //the parser state and the config fields that are std::pmr containers or strings are allocated from the memory
+    //resource, it must outlive the read config. The resource is used only by this call, so concurrent reads
+    //of a compiled reader can use their own arenas.
+    template<typename TCfg>
+    TCfg read(int argc, char** argv, std::pmr::memory_resource& memoryResource)
+    {
+        return readCommandLine<TCfg>(detail::makeCommandLine(argc, argv), &memoryResource);
+    }
+
+    template<typename TCfg>
+    TCfg read(const std::vector<std::string>& cmdLine, std::pmr::memory_resource& memoryResource)
+    {
+        return readCommandLine<TCfg>(detail::makeCommandLine(cmdLine), &memoryResource);
+    }
+
+    //reads the command line like read<TCfg>(), but returns the parsing and validation errors instead of throwing them.
+    //With ReadErrorMode::CollectAllErrors, all errors of the command line are returned.
+    template<typename TCfg>
+    ReadResult<TCfg> tryRead(int argc, char** argv)
+    {
+        return tryReadCommandLine<TCfg>(detail::makeCommandLine(argc, argv));
+    }
+
+    template<typename TCfg>
+    ReadResult<TCfg> tryRead(const std::vector<std::string>& cmdLine)
+    {
+        return tryReadCommandLine<TCfg>(detail::makeCommandLine(cmdLine));
+    }
+
+    template<typename TCfg>
+    ReadResult<TCfg> tryRead(int argc, char** argv, std::pmr::memory_resource& memoryResource)
+    {
+        return tryReadCommandLine<TCfg>(detail::makeCommandLine(argc, argv), &memoryResource);
+    }
+
+    template<typename TCfg>
+    ReadResult<TCfg> tryRead(const std::vector<std::string>& cmdLine, std::pmr::memory_resource& memoryResource)
+    {
+        return tryReadCommandLine<TCfg>(detail::makeCommandLine(cmdLine), &memoryResource);
+    }
+
+    //builds the options of TCfg once, the following read<TCfg>() calls fill copies of the compiled config object
+    //instead of rebuilding them. Reading other config types or calling exec() discards the compiled options.
+    //The options of all commands are built too, so the compiled options aren't modified by read<TCfg>(),
+    //and it can be called concurrently from multiple threads.
+    template<typename TCfg>
+    void compile()
+    {
+        static_assert(std::is_copy_constructible_v<TCfg>, "Compiled config objects must be copy constructible");
         auto cfg = makeCfg<TCfg>();
-        setCommandName(commandName_);
-        setUsageInfoFormat(usageInfoFormat_);
-        if (read(cmdLine) != detail::CommandLineReadResult::StoppedOnExitFlag)
-            validate({});
         resetCommandLineReader(cfg);
-        try {
-            PostProcessor<TCfg>{}(cfg);
-        }
-        catch (const ValidationError& e) {
-            throw ParsingError{std::string{"Command line is invalid: "} + e.what()};
-        }
-        return cfg;
+        makeCommandReaders(options_);
+        checkSchema();
+        compiledCfg_ = std::make_shared<TCfg>(std::move(cfg));
+        compiledCfgType_ = cfgType<TCfg>();
     }
 
     template<typename TCfg>
     int exec(int argc, char** argv, std::function<int(const TCfg&)> func)
     {
-        auto cmdLine = std::vector<std::string>(argv + 1, argv + argc);
-        return exec<TCfg>(cmdLine, func);
+        return execCommandLine<TCfg>(detail::makeCommandLine(argc, argv), func);
     }
 
     template<typename TCfg>
     int exec(int argc, char** argv, std::function<int(int, char**, const TCfg&)> func)
     {
-        auto cmdLine = std::vector<std::string>(argv + 1, argv + argc);
-        return exec<TCfg>(
-                cmdLine,
+        return execCommandLine<TCfg>(
+                detail::makeCommandLine(argc, argv),
                 [=](const TCfg& cfg)
                 {
                     return func(argc, argv, cfg);
@@ -120,37 +178,7 @@ public:
     template<typename TCfg>
     int exec(const std::vector<std::string>& cmdLine, std::function<int(const TCfg&)> func)
     {
-        auto cfg = makeCfg<TCfg>();
-        setCommandName(commandName_);
-        setUsageInfoFormat(usageInfoFormat_);
-        addDefaultFlags();
-        try {
-            if (read(cmdLine) != detail::CommandLineReadResult::StoppedOnExitFlag)
-                validate({});
-        }
-        catch (const CommandError& e) {
-            errorOutput_.get() << "Command '" + e.commandName() + "' error: " << e.what() << "\n";
-            output_.get() << e.commandUsageInfo() << std::endl;
-            return 1;
-        }
-        catch (const Error& e) {
-            errorOutput_.get() << e.what() << "\n";
-            output_.get() << usageInfo() << std::endl;
-            return 1;
-        }
-        if (processDefaultFlags())
-            return 0;
-
-        try {
-            PostProcessor<TCfg>{}(cfg);
-        }
-        catch (const ValidationError& e) {
-            errorOutput_.get() << "Command line is invalid: " << e.what() << "\n";
-            return 1;
-        }
-
-        resetCommandLineReader(cfg);
-        return func(cfg);
+        return execCommandLine<TCfg>(detail::makeCommandLine(cmdLine), func);
     }
 
     const std::string& versionInfo() const override
@@ -161,24 +189,23 @@ public:
     template<typename TCfg>
     std::string usageInfo()
     {
-        makeCfg<TCfg>();
-        setCommandName(commandName_);
-        setUsageInfoFormat(usageInfoFormat_);
+        if (!isCompiled<TCfg>())
+            makeCfg<TCfg>();
         return usageInfo();
     }
 
     template<typename TCfg>
     std::string usageInfoDetailed()
     {
-        makeCfg<TCfg>();
-        setCommandName(commandName_);
-        setUsageInfoFormat(usageInfoFormat_);
+        if (!isCompiled<TCfg>())
+            makeCfg<TCfg>();
         return usageInfoDetailed();
     }
 
     void setVersionInfo(const std::string& info)
     {
         versionInfo_ = info;
+        resetUsageInfo();
     }
 
     void setUsageInfo(const std::string& info)
@@ -199,6 +226,7 @@ public:
     void setUsageInfoFormat(const UsageInfoFormat& format) override
     {
         usageInfoFormat_ = format;
+        resetUsageInfo();
         for (auto& command : options_.commands())
             command->setUsageInfoFormat(format);
     }
@@ -213,19 +241,141 @@ public:
         errorOutput_ = outStream;
     }
 
+    //with ReadErrorMode::CollectAllErrors, reading continues after errors, so tryRead() returns all of them
+    //and exec() prints all of them. Validators are used only if the command line is read without errors.
+    void setReadErrorMode(ReadErrorMode mode)
+    {
+        readErrorMode_ = mode;
+    }
+
 private:
+    template<typename TCfg>
+    TCfg readCommandLine(detail::CommandLineView cmdLine, std::pmr::memory_resource* memoryResource = nullptr)
+    {
+        auto cfg = makeReadCfg<TCfg>();
+        const auto errors = readConfig(cfg, cmdLine, memoryResource);
+        if (!errors.empty())
+            throwReadError(errors.front());
+        return cfg;
+    }
+
+    template<typename TCfg>
+    ReadResult<TCfg> tryReadCommandLine(
+            detail::CommandLineView cmdLine,
+            std::pmr::memory_resource* memoryResource = nullptr)
+    {
+        //config errors thrown while the config structures of the reader or its commands are created,
+        //like an empty custom name, are returned as errors too
+        try {
+            auto cfg = makeReadCfg<TCfg>();
+            auto errors = readConfig(cfg, cmdLine, memoryResource);
+            if (!errors.empty())
+                return ReadResult<TCfg>{std::move(errors)};
+            return ReadResult<TCfg>{std::move(cfg)};
+        }
+        catch (const ConfigError& error) {
+            auto errors = std::vector<ReadError>{};
+            errors.emplace_back(detail::ReadErrorType::ConfigError, "", "", "", error.what());
+            return ReadResult<TCfg>{std::move(errors)};
+        }
+    }
+
+    template<typename TCfg>
+    std::vector<ReadError> readConfig(
+            TCfg& cfg,
+            detail::CommandLineView cmdLine,
+            std::pmr::memory_resource* memoryResource)
+    {
+        auto errors = readAndValidate(cfg, cmdLine, memoryResource);
+        resetCommandLineReader(cfg);
+        if (!errors.empty())
+            return errors;
+        try {
+            PostProcessor<TCfg>{}(cfg);
+        }
+        catch (const ValidationError& e) {
+            errors.emplace_back(detail::ReadErrorType::InvalidCommandLine, "", "", "", e.what());
+        }
+        return errors;
+    }
+
+    std::vector<ReadError> readAndValidate(
+            Config& cfg,
+            detail::CommandLineView cmdLine,
+            std::pmr::memory_resource* memoryResource = nullptr)
+    {
+        auto errors = std::vector<ReadError>{};
+        if (read(cfg, cmdLine, readErrorMode_, errors, memoryResource) == detail::CommandLineReadResult::Completed)
+            validate(cfg, {}, readErrorMode_, errors);
+        return errors;
+    }
+
+    [[noreturn]] static void throwReadError(const ReadError& error)
+    {
+        if (auto usageInfoRenderer = detail::ReadErrorAccess::commandUsageInfoRenderer(error)) {
+            if (error.kind() == ReadErrorKind::ConfigError)
+                throw CommandConfigError{
+                        error.commandName(),
+                        std::move(usageInfoRenderer),
+                        ConfigError{error.message()}};
+            throw CommandParsingError{
+                    error.commandName(),
+                    std::move(usageInfoRenderer),
+                    ParsingError{error.message()}};
+        }
+        if (error.kind() == ReadErrorKind::ConfigError)
+            throw ConfigError{error.message()};
+        throw ParsingError{error.message()};
+    }
+
+    template<typename TCfg>
+    int execCommandLine(detail::CommandLineView cmdLine, const std::function<int(const TCfg&)>& func)
+    {
+        auto cfg = makeCfg<TCfg>();
+        addDefaultFlags();
+        const auto errors = readAndValidate(cfg, cmdLine);
+        if (!errors.empty()) {
+            for (const auto& error : errors) {
+                if (detail::ReadErrorAccess::commandUsageInfoRenderer(error))
+                    errorOutput_.get() << "Command '" + error.commandName() + "' error: ";
+                errorOutput_.get() << error.message() << "\n";
+            }
+            if (auto usageInfoRenderer = detail::ReadErrorAccess::commandUsageInfoRenderer(errors.front()))
+                output_.get() << usageInfoRenderer() << std::endl;
+            else
+                output_.get() << usageInfoText() << std::endl;
+            return 1;
+        }
+        if (processDefaultFlags())
+            return 0;
+
+        try {
+            PostProcessor<TCfg>{}(cfg);
+        }
+        catch (const ValidationError& e) {
+            errorOutput_.get() << "Command line is invalid: " << e.what() << "\n";
+            return 1;
+        }
+
+        resetCommandLineReader(cfg);
+        return func(cfg);
+    }
+
     void addParam(std::unique_ptr<detail::IParam> param) override
     {
+        isSchemaChecked_ = false;
         options_.addParam(std::move(param));
     }
 
     void addParamList(std::unique_ptr<detail::IParamList> paramList) override
     {
+        isSchemaChecked_ = false;
         options_.addParamList(std::move(paramList));
     }
 
     void addFlag(std::unique_ptr<detail::IFlag> flag) override
     {
+        isSchemaChecked_ = false;
         options_.addFlag(std::move(flag));
     }
 
@@ -246,6 +396,8 @@ private:
 
     void addCommand(std::unique_ptr<detail::ICommand> command) override
     {
+        command->setCommandName(commandName_);
+        command->setUsageInfoFormat(usageInfoFormat_);
         options_.addCommand(std::move(command));
     }
 
@@ -257,6 +409,7 @@ private:
     void setCommandName(const std::string& name) override
     {
         commandName_ = name;
+        resetUsageInfo();
         for (auto& command : options_.commands())
             command->setCommandName(name);
     }
@@ -266,18 +419,31 @@ private:
         validators_.emplace_back(std::move(validator));
     }
 
-    void validate(const std::string& commandName) const override
+    void validate(
+            Config& cfg,
+            const std::string& commandName,
+            ReadErrorMode errorMode,
+            std::vector<ReadError>& errors) const override
     {
+        auto isStopped = [&]
+        {
+            return errorMode == ReadErrorMode::StopOnFirstError && !errors.empty();
+        };
         auto commandIsSet = false;
         for (auto& command : options_.commands()) {
-            command->validate();
-            if (command->hasValue() && !command->isSubCommand())
+            command->validate(cfg, errorMode, errors);
+            if (isStopped())
+                return;
+            if (command->hasValue(cfg) && !command->isSubCommand())
                 commandIsSet = true;
         }
         for (auto& validator : validators_) {
             if (commandIsSet && validator->optionType() != detail::OptionType::Command)
                 continue;
-            validator->validate(commandName);
+            if (auto error = validator->validate(cfg, commandName))
+                errors.push_back(std::move(*error));
+            if (isStopped())
+                return;
         }
     }
 
@@ -291,35 +457,103 @@ private:
         return detail::FormatCfg<formatType>::shortNamesEnabled;
     }
 
-    detail::CommandLineReadResult read(const std::vector<std::string>& cmdLine) override
+    detail::CommandLineReadResult read(
+            Config& cfg,
+            detail::CommandLineView cmdLine,
+            ReadErrorMode errorMode,
+            std::vector<ReadError>& errors,
+            std::pmr::memory_resource* memoryResource) override
+    {
+        checkSchema();
+        if (!configError_.empty()) {
+            errors.emplace_back(detail::ReadErrorType::ConfigError, "", "", "", configError_);
+            return detail::CommandLineReadResult::Failed;
+        }
+        using ParserType = typename detail::FormatCfg<formatType>::parser;
+        auto parser = ParserType{options_, cfg, errorMode, memoryResource};
+        const auto result = parser.parse(cmdLine);
+        std::move(parser.errors().begin(), parser.errors().end(), std::back_inserter(errors));
+        return result;
+    }
+
+    //the found error is stored and reported when the command line is read
+    void checkSchema() override
     {
+        if (isSchemaChecked_)
+            return;
+        isSchemaChecked_ = true;
+        for (auto& command : options_.commands())
+            if (command->configReader())
+                command->configReader()->checkSchema();
         if (!configError_.empty())
-            throw ConfigError{configError_};
+            return;
+
         using ParserType = typename detail::FormatCfg<formatType>::parser;
-        auto parser = ParserType{options_};
-        return parser.parse(cmdLine);
+        try {
+            ParserType::checkUniqueNames(options_);
+            ParserType::checkNames(options_);
+        }
+        catch (const ConfigError& error) {
+            configError_ = error.what();
+        }
     }
 
     detail::CommandLineReaderPtr makeNestedReader(const std::string& name) override
     {
-        nestedReaders_.emplace(name, std::make_unique<CommandLineReader<formatType>>());
+        nestedReaders_.emplace(name, std::make_shared<CommandLineReader<formatType>>());
         return nestedReaders_[name]->makePtr();
     }
 
+    std::shared_ptr<const detail::ICommandLineReader> nestedReader(const std::string& name) const override
+    {
+        auto it = nestedReaders_.find(name);
+        if (it == nestedReaders_.end())
+            return nullptr;
+        return it->second;
+    }
+
     std::string usageInfo() const override
+    {
+        return usageInfoText();
+    }
+
+    std::string usageInfoDetailed() const override
+    {
+        return usageInfoDetailedText();
+    }
+
+    //the usage info texts are rendered once for the same options and printed from the cache without copying
+    const std::string& usageInfoText() const
     {
         if (!customUsageInfo_.empty())
             return customUsageInfo_;
 
-        return detail::UsageInfoCreator<formatType>{commandName_, usageInfoFormat_, options_}.create();
+        return usageInfo_.get(
+                detail::UsageInfoSource{options_},
+                [this]
+                {
+                    return detail::UsageInfoCreator<formatType>{commandName_, usageInfoFormat_, options_}.create();
+                });
     }
 
-    std::string usageInfoDetailed() const override
+    const std::string& usageInfoDetailedText() const
     {
         if (!customUsageInfoDetailed_.empty())
             return customUsageInfoDetailed_;
 
-        return detail::UsageInfoCreator<formatType>{commandName_, usageInfoFormat_, options_}.createDetailed();
+        return usageInfoDetailed_.get(
+                detail::UsageInfoSource{options_},
+                [this]
+                {
+                    return detail::UsageInfoCreator<formatType>{commandName_, usageInfoFormat_, options_}
+                            .createDetailed();
+                });
+    }
+
+    void resetUsageInfo()
+    {
+        usageInfo_.reset();
+        usageInfoDetailed_.reset();
     }
 
     void clear()
@@ -328,7 +562,41 @@ private:
         options_ = detail::Options{};
         validators_.clear();
         argListSet_ = false;
+        isSchemaChecked_ = false;
+        help_ = false;
+        version_ = false;
         nestedReaders_.clear();
+        compiledCfg_.reset();
+        compiledCfgType_ = nullptr;
+    }
+
+    static void makeCommandReaders(const detail::Options& options)
+    {
+        for (auto& command : options.commands())
+            if (auto commandReader = command->makeConfigReader())
+                makeCommandReaders(commandReader->options());
+    }
+
+    template<typename TCfg>
+    TCfg makeReadCfg()
+    {
+        if constexpr (std::is_copy_constructible_v<TCfg>)
+            if (isCompiled<TCfg>())
+                return static_cast<const TCfg&>(*compiledCfg_);
+        return makeCfg<TCfg>();
+    }
+
+    template<typename TCfg>
+    bool isCompiled() const
+    {
+        return compiledCfg_ && compiledCfgType_ == cfgType<TCfg>();
+    }
+
+    template<typename TCfg>
+    static const void* cfgType()
+    {
+        static const auto type = char{};
+        return &type;
     }
 
     template<typename TCfg>
@@ -336,8 +604,7 @@ private:
     {
         clear();
         if constexpr (std::is_aggregate_v<TCfg>)
-            return TCfg{{makePtr()}}; //can't add setCommandName and setUsageInfoFormat calls here
-                                      // due to the lack of NRVO on MSVC (the config object must not be copied)
+            return TCfg{{makePtr()}};
         else {
             static_assert(
                     std::is_constructible_v<TCfg, detail::CommandLineReaderPtr>,
@@ -374,7 +641,7 @@ private:
     bool processDefaultFlags()
     {
         if (help_) {
-            output_.get() << usageInfoDetailed() << std::endl;
+            output_.get() << usageInfoDetailedText() << std::endl;
             return true;
         }
         if (version_) {
@@ -396,7 +663,8 @@ private:
             return true;
         }
 
-        if (command.hasValue())
+        //help flags of the commands that weren't read are never set
+        if (command.configReader())
             for (auto& childCommand : command.configReader()->options().commands())
                 if (checkCommandHelpFlag(*childCommand))
                     return true;
@@ -413,16 +681,36 @@ private:
     std::string commandName_;
     UsageInfoFormat usageInfoFormat_;
     std::vector<std::unique_ptr<detail::IValidator>> validators_;
+    ReadErrorMode readErrorMode_ = ReadErrorMode::StopOnFirstError;
     bool argListSet_ = false;
+    bool isSchemaChecked_ = false;
+    detail::UsageInfoCache usageInfo_;
+    detail::UsageInfoCache usageInfoDetailed_;
 
     std::reference_wrapper<std::ostream> errorOutput_ = std::cerr;
     std::reference_wrapper<std::ostream> output_ = std::cout;
     bool help_ = false;
     bool version_ = false;
 
-    std::map<std::string, std::unique_ptr<CommandLineReader<formatType>>> nestedReaders_;
+    std::map<std::string, std::shared_ptr<CommandLineReader<formatType>>> nestedReaders_;
+    std::shared_ptr<const Config> compiledCfg_;
+    const void* compiledCfgType_ = nullptr;
+};
+
+namespace detail {
+
+class CommandLineReaderAccess {
+public:
+    //number of the usage info texts rendered by the reader, the nested readers of commands aren't counted
+    template<Format formatType>
+    static std::size_t usageInfoRenderCount(const CommandLineReader<formatType>& reader)
+    {
+        return reader.usageInfo_.renderCount() + reader.usageInfoDetailed_.renderCount();
+    }
 };
 
+} //namespace detail
+
 using GNUCommandLineReader = CommandLineReader<Format::GNU>;
 using X11CommandLineReader = CommandLineReader<Format::X11>;
 using POSIXCommandLineReader = CommandLineReader<Format::POSIX>;
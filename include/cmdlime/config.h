@@ -1,6 +1,7 @@
 #ifndef CMDLIME_CONFIG_H
 #define CMDLIME_CONFIG_H
 
+#include "arglistsink.h"
 #include "customnames.h"
 #include "detail/argcreator.h"
 #include "detail/arglistcreator.h"
@@ -155,13 +156,19 @@ protected:
     }
 
 private:
+    template<auto member, typename T, typename TCfg>
+    static T& field(Config& cfg)
+    {
+        return static_cast<TCfg&>(cfg).*member;
+    }
+
 #ifdef CMDLIME_NAMEOF_AVAILABLE
     template<auto member, typename T, typename TCfg>
     auto param(T TCfg::*)
     {
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, memberTypeName] = detail::getMemberPtrNameAndType<member>(cfg);
-        return detail::ParamCreator<T>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ParamCreator<T>{reader(), memberName, memberTypeName, &field<member, T, TCfg>};
     }
 
     template<auto member, typename TParamList, typename TCfg>
@@ -170,7 +177,11 @@ private:
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, _] = detail::getMemberPtrNameAndType<member>(cfg);
         const auto memberTypeName = detail::nameOfType<TParamList>();
-        return detail::ParamListCreator<TParamList>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ParamListCreator<TParamList>{
+                reader(),
+                memberName,
+                memberTypeName,
+                &field<member, TParamList, TCfg>};
     }
 
     template<auto member, typename TCfg>
@@ -178,7 +189,7 @@ private:
     {
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, _] = detail::getMemberPtrNameAndType<member>(cfg);
-        return detail::FlagCreator{reader(), memberName, cfg->*member};
+        return detail::FlagCreator{reader(), memberName, &field<member, bool, TCfg>};
     }
 
     template<auto member, typename TCfg>
@@ -186,7 +197,7 @@ private:
     {
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, _] = detail::getMemberPtrNameAndType<member>(cfg);
-        return detail::FlagCreator{reader(), memberName, cfg->*member, detail::Flag::Type::Exit};
+        return detail::FlagCreator{reader(), memberName, &field<member, bool, TCfg>, detail::Flag::Type::Exit};
     }
 
     template<auto member, typename T, typename TCfg>
@@ -194,7 +205,7 @@ private:
     {
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, memberTypeName] = detail::getMemberPtrNameAndType<member>(cfg);
-        return detail::ArgCreator<T>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ArgCreator<T>{reader(), memberName, memberTypeName, &field<member, T, TCfg>};
     }
 
     template<auto member, typename TArgList, typename TCfg>
@@ -203,7 +214,7 @@ private:
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, _] = detail::getMemberPtrNameAndType<member>(cfg);
         const auto memberTypeName = detail::nameOfType<TArgList>();
-        return detail::ArgListCreator<TArgList>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ArgListCreator<TArgList>{reader(), memberName, memberTypeName, &field<member, TArgList, TCfg>};
     }
 
     template<auto member, typename T, typename TCfg>
@@ -211,7 +222,7 @@ private:
     {
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, _] = detail::getMemberPtrNameAndType<member>(cfg);
-        return detail::CommandCreator<T>{reader(), memberName, cfg->*member};
+        return detail::CommandCreator<T>{reader(), memberName, &field<member, detail::InitializedOptional<T>, TCfg>};
     }
 
     template<auto member, typename T, typename TCfg>
@@ -219,64 +230,68 @@ private:
     {
         auto cfg = static_cast<TCfg*>(this);
         auto [memberName, _] = detail::getMemberPtrNameAndType<member>(cfg);
-        return detail::CommandCreator<T>{reader(), memberName, cfg->*member, detail::Command<T>::Type::SubCommand};
+        return detail::CommandCreator<T>{
+                reader(),
+                memberName,
+                &field<member, detail::InitializedOptional<T>, TCfg>,
+                detail::Command<T>::Type::SubCommand};
     }
 #endif
 
     template<auto member, typename T, typename TCfg>
     auto param(T TCfg::*, const std::string& memberName, const std::string& memberTypeName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::ParamCreator<T>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ParamCreator<T>{reader(), memberName, memberTypeName, &field<member, T, TCfg>};
     }
 
     template<auto member, typename TParamList, typename TCfg>
     auto paramList(TParamList TCfg::*, const std::string& memberName, const std::string& memberTypeName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::ParamListCreator<TParamList>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ParamListCreator<TParamList>{
+                reader(),
+                memberName,
+                memberTypeName,
+                &field<member, TParamList, TCfg>};
     }
 
     template<auto member, typename TCfg>
     auto flag(bool TCfg::*, const std::string& memberName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::FlagCreator{reader(), memberName, cfg->*member};
+        return detail::FlagCreator{reader(), memberName, &field<member, bool, TCfg>};
     }
 
     template<auto member, typename TCfg>
     auto exitFlag(bool TCfg::*, const std::string& memberName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::FlagCreator{reader(), memberName, cfg->*member, detail::Flag::Type::Exit};
+        return detail::FlagCreator{reader(), memberName, &field<member, bool, TCfg>, detail::Flag::Type::Exit};
     }
 
     template<auto member, typename T, typename TCfg>
     auto arg(T TCfg::*, const std::string& memberName, const std::string& memberTypeName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::ArgCreator<T>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ArgCreator<T>{reader(), memberName, memberTypeName, &field<member, T, TCfg>};
     }
 
     template<auto member, typename TArgList, typename TCfg>
     auto argList(TArgList TCfg::*, const std::string& memberName, const std::string& memberTypeName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::ArgListCreator<TArgList>{reader(), memberName, memberTypeName, cfg->*member};
+        return detail::ArgListCreator<TArgList>{reader(), memberName, memberTypeName, &field<member, TArgList, TCfg>};
     }
 
     template<auto member, typename T, typename TCfg>
     auto command(detail::InitializedOptional<T> TCfg::*, const std::string& memberName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::CommandCreator<T>{reader(), memberName, cfg->*member};
+        return detail::CommandCreator<T>{reader(), memberName, &field<member, detail::InitializedOptional<T>, TCfg>};
     }
 
     template<auto member, typename T, typename TCfg>
     auto subCommand(detail::InitializedOptional<T> TCfg::*, const std::string& memberName)
     {
-        auto cfg = static_cast<TCfg*>(this);
-        return detail::CommandCreator<T>{reader(), memberName, cfg->*member, detail::Command<T>::Type::SubCommand};
+        return detail::CommandCreator<T>{
+                reader(),
+                memberName,
+                &field<member, detail::InitializedOptional<T>, TCfg>,
+                detail::Command<T>::Type::SubCommand};
     }
 
 private:
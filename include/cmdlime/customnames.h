@@ -34,6 +34,31 @@ private:
     std::string value_;
 };
 
+//sets the delimiter of the values passed in a single parameter list element, ',' is used by default
+class Delimiter {
+public:
+    Delimiter(std::string delimiter)
+        : value_(std::move(delimiter))
+    {
+        if (value_.empty())
+            throw ConfigError{"Parameter list delimiter can't be empty."};
+    }
+
+    const std::string& value() const
+    {
+        return value_;
+    }
+
+private:
+    std::string value_;
+};
+
+//converts the elements of a list on multiple threads, the StringConverter of the element type must be thread-safe.
+//If the thread count isn't set, std::thread::hardware_concurrency() is used.
+struct ParallelConversion {
+    int threadCount = 0;
+};
+
 using Name = CustomName<detail::CustomNameType::Name>;
 using ShortName = CustomName<detail::CustomNameType::ShortName>;
 using ValueName = CustomName<detail::CustomNameType::ValueName>;
@@ -1,7 +1,9 @@
 #ifndef CMDLIME_ARG_H
 #define CMDLIME_ARG_H
 
+#include "configfield.h"
 #include "iarg.h"
+#include "memoryresource.h"
 #include "optioninfo.h"
 #include <cmdlime/customnames.h>
 #include <cmdlime/errors.h>
@@ -15,9 +17,9 @@ namespace cmdlime::detail {
 template<typename T>
 class Arg : public IArg {
 public:
-    Arg(std::string name, std::string type, T& argValue)
+    Arg(std::string name, std::string type, ConfigField<T> argField)
         : info_(std::move(name), {}, std::move(type))
-        , argValue_(argValue)
+        , argField_(argField)
     {
     }
 
@@ -37,14 +39,23 @@ public:
     }
 
 private:
-    void read(const std::string& data) override
+    bool read(Config& cfg, std::string_view data) override
     {
-        argValue_ = convertFromString<T>(data);
+        auto value = convertFromString<T>(data);
+        if (!value)
+            return false;
+        argField_(cfg) = std::move(*value);
+        return true;
+    }
+
+    void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) override
+    {
+        moveToMemoryResource(argField_(cfg), resource);
     }
 
 private:
     OptionInfo info_;
-    T& argValue_;
+    ConfigField<T> argField_;
 };
 
 } //namespace cmdlime::detail
@@ -2,6 +2,7 @@
 #define CMDLIME_ARGCREATOR_H
 
 #include "arg.h"
+#include "configfield.h"
 #include "icommandlinereader.h"
 #include "nameformat.h"
 #include "validator.h"
@@ -16,14 +17,14 @@ public:
             CommandLineReaderPtr reader,
             sfun::not_empty<const std::string&> varName,
             sfun::not_empty<const std::string&> type,
-            T& argValue)
+            ConfigField<T> argField)
         : reader_(reader)
-        , argValue_(argValue)
+        , argField_(argField)
     {
         arg_ = std::make_unique<Arg<T>>(
                 reader_ ? NameFormat::fullName(reader_->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::valueName(reader_->format(), type.get()) : type.get(),
-                argValue);
+                argField);
     }
 
     auto& operator<<(const std::string& info)
@@ -47,7 +48,7 @@ public:
     auto& operator<<(std::function<void(const T&)> validationFunc)
     {
         if (reader_)
-            reader_->addValidator(std::make_unique<Validator<T>>(*arg_, argValue_, std::move(validationFunc)));
+            reader_->addValidator(std::make_unique<Validator<T>>(*arg_, argField_, std::move(validationFunc)));
         return *this;
     }
 
@@ -61,7 +62,7 @@ public:
 private:
     std::unique_ptr<Arg<T>> arg_;
     CommandLineReaderPtr reader_;
-    T& argValue_;
+    ConfigField<T> argField_;
 };
 
 } //namespace cmdlime::detail
@@ -1,14 +1,19 @@
 #ifndef CMDLIME_ARGLIST_H
 #define CMDLIME_ARGLIST_H
 
+#include "configfield.h"
 #include "iarglist.h"
+#include "listconversion.h"
+#include "memoryresource.h"
 #include "optioninfo.h"
+#include <cmdlime/arglistsink.h>
 #include <cmdlime/customnames.h>
 #include <cmdlime/errors.h>
 #include <cmdlime/stringconverter.h>
 #include <functional>
 #include <memory>
-#include <sstream>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace cmdlime::detail {
@@ -16,16 +21,20 @@ namespace cmdlime::detail {
 template<typename TArgList>
 class ArgList : public IArgList {
 public:
-    ArgList(std::string name, std::string type, TArgList& argListValue)
+    ArgList(std::string name, std::string type, ConfigField<TArgList> argListField)
         : info_(std::move(name), {}, std::move(type))
-        , argListValue_(argListValue)
+        , argListField_(argListField)
     {
     }
 
+    void setParallelConversion(int threadCount)
+    {
+        parallelConversionThreadCount_ = threadCount;
+    }
+
     void setDefaultValue(const TArgList& value)
     {
-        hasValue_ = true;
-        defaultValue_ = value;
+        defaultValue_ = toString(value);
     }
 
     OptionInfo& info() override
@@ -44,20 +53,57 @@ public:
     }
 
 private:
-    void read(const std::string& data) override
+    std::vector<ConversionFailure> read(
+            Config& cfg,
+            const std::pmr::vector<std::string_view>& values,
+            bool stopOnFirstFailure) override
+    {
+        if constexpr (isParallelConvertible<TArgList>::value)
+            if (parallelConversionThreadCount_)
+                return appendConvertedInParallel(
+                        argListField_(cfg),
+                        values,
+                        *parallelConversionThreadCount_,
+                        stopOnFirstFailure);
+
+        return appendConverted(argListField_(cfg), values, stopOnFirstFailure);
+    }
+
+    bool isSink() const override
+    {
+        return isArgListSink<TArgList>::value;
+    }
+
+    bool read(Config& cfg, std::string_view data) override
     {
-        if (!isDefaultValueOverwritten_) {
-            argListValue_.clear();
-            isDefaultValueOverwritten_ = true;
+        auto element = convertFromString<typename TArgList::value_type>(data);
+        if (!element)
+            return false;
+        if constexpr (isArgListSink<TArgList>::value) {
+            //errors thrown by the sink's handler are reported like the ones of the string converters
+            try {
+                argListField_(cfg).emplace_back(std::move(*element));
+            }
+            catch (const ValidationError& error) {
+                throw StringConversionError{error.what()};
+            }
+            catch (...) {
+                throw StringConversionError{};
+            }
         }
-        auto argVal = convertFromString<typename TArgList::value_type>(data);
-        argListValue_.emplace_back(std::move(argVal));
-        hasValue_ = true;
+        else
+            argListField_(cfg).emplace_back(std::move(*element));
+        return true;
+    }
+
+    void clear(Config& cfg) override
+    {
+        argListField_(cfg).clear();
     }
 
-    bool hasValue() const override
+    void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) override
     {
-        return hasValue_;
+        moveToMemoryResource(argListField_(cfg), resource);
     }
 
     bool isOptional() const override
@@ -67,30 +113,35 @@ private:
 
     std::string defaultValue() const override
     {
-        if (!defaultValue_)
+        return defaultValue_.value_or(std::string{});
+    }
+
+    static std::string toString([[maybe_unused]] const TArgList& value)
+    {
+        if constexpr (isArgListSink<TArgList>::value)
             return {};
-        auto stream = std::stringstream{};
-        stream << "{";
-        auto firstVal = true;
-        for (auto& val : *defaultValue_) {
-            if (firstVal)
-                stream << ", ";
-            firstVal = false;
-            auto valStr = convertToString(val);
-            if (!valStr)
-                return {};
-            stream << *valStr;
+        else {
+            auto result = std::string{"{"};
+            auto firstVal = true;
+            for (auto& val : value) {
+                if (firstVal)
+                    result += ", ";
+                firstVal = false;
+                auto valStr = convertToString(val);
+                if (!valStr)
+                    return {};
+                result += *valStr;
+            }
+            result += "}";
+            return result;
         }
-        stream << "}";
-        return stream.str();
     }
 
 private:
     OptionInfo info_;
-    TArgList& argListValue_;
-    bool hasValue_ = false;
-    std::optional<TArgList> defaultValue_;
-    bool isDefaultValueOverwritten_ = false;
+    ConfigField<TArgList> argListField_;
+    std::optional<std::string> defaultValue_;
+    std::optional<int> parallelConversionThreadCount_;
 };
 
 } //namespace cmdlime::detail
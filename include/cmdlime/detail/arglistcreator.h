@@ -2,6 +2,7 @@
 #define CMDLIME_ARGLISTCREATOR_H
 
 #include "arglist.h"
+#include "configfield.h"
 #include "icommandlinereader.h"
 #include "nameformat.h"
 #include "validator.h"
@@ -12,21 +13,23 @@ namespace cmdlime::detail {
 
 template<typename TArgList>
 class ArgListCreator {
-    static_assert(sfun::is_dynamic_sequence_container_v<TArgList>, "Argument list field must be a sequence container");
+    static_assert(
+            sfun::is_dynamic_sequence_container_v<TArgList> || isArgListSink<TArgList>::value,
+            "Argument list field must be a sequence container or cmdlime::ArgListSink");
 
 public:
     ArgListCreator(
             CommandLineReaderPtr reader,
             sfun::not_empty<const std::string&> varName,
             sfun::not_empty<const std::string&> type,
-            TArgList& argListValue)
+            ConfigField<TArgList> argListField)
         : reader_(reader)
-        , argListValue_(argListValue)
+        , argListField_(argListField)
     {
         argList_ = std::make_unique<ArgList<TArgList>>(
                 reader_ ? NameFormat::fullName(reader_->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::valueName(reader_->format(), type.get()) : type.get(),
-                argListValue);
+                argListField);
     }
 
     auto& operator<<(const std::string& info)
@@ -47,11 +50,28 @@ public:
         return *this;
     }
 
+    //sets the handler of the elements read into cmdlime::ArgListSink
+    template<typename T = TArgList>
+    auto& operator<<(std::enable_if_t<isArgListSink<T>::value, T> sink)
+    {
+        defaultValue_ = std::move(sink);
+        return *this;
+    }
+
+    auto& operator<<(const ParallelConversion& parallelConversion)
+    {
+        static_assert(
+                isParallelConvertible<TArgList>::value,
+                "Parallel conversion requires a resizable random access container of default constructible elements");
+        argList_->setParallelConversion(parallelConversion.threadCount);
+        return *this;
+    }
+
     auto& operator<<(std::function<void(const TArgList&)> validationFunc)
     {
         if (reader_)
             reader_->addValidator(
-                    std::make_unique<Validator<TArgList>>(*argList_, argListValue_, std::move(validationFunc)));
+                    std::make_unique<Validator<TArgList>>(*argList_, argListField_, std::move(validationFunc)));
         return *this;
     }
 
@@ -73,7 +93,7 @@ private:
     std::unique_ptr<ArgList<TArgList>> argList_;
     TArgList defaultValue_;
     CommandLineReaderPtr reader_;
-    TArgList& argListValue_;
+    ConfigField<TArgList> argListField_;
 };
 
 } //namespace cmdlime::detail
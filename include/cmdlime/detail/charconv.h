@@ -0,0 +1,73 @@
+#ifndef CMDLIME_CHARCONV_H
+#define CMDLIME_CHARCONV_H
+
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace cmdlime::detail {
+
+template<typename T>
+inline constexpr bool isCharacterType_v = std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+        std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> || std::is_same_v<T, char16_t> ||
+#ifdef __cpp_char8_t
+        std::is_same_v<T, char8_t> ||
+#endif
+        std::is_same_v<T, char32_t>;
+
+//bool and character types are read by streams as words and symbols, so they're not converted with <charconv>
+template<typename T>
+inline constexpr bool isCharConvertible_v = (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                                             !isCharacterType_v<T>)
+#ifdef __cpp_lib_to_chars
+        || std::is_floating_point_v<T>
+#endif
+        ;
+
+//returns std::errc::invalid_argument if the whole string isn't a number,
+//a leading '+' is accepted and infinity or NaN aren't, like when numbers are read by streams
+template<typename T>
+std::errc fromChars(std::string_view str, T& value)
+{
+    static_assert(isCharConvertible_v<T>);
+    if (!str.empty() && str.front() == '+') {
+        str.remove_prefix(1);
+        if (!str.empty() && str.front() == '-')
+            return std::errc::invalid_argument;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        const auto digits = (!str.empty() && str.front() == '-') ? str.substr(1) : str;
+        if (digits.empty() || !(std::isdigit(static_cast<unsigned char>(digits.front())) || digits.front() == '.'))
+            return std::errc::invalid_argument;
+    }
+
+    const auto end = str.data() + str.size();
+    const auto [ptr, error] = std::from_chars(str.data(), end, value);
+    if (ptr != end)
+        return std::errc::invalid_argument;
+    return error;
+}
+
+//floating point numbers are written in the same format as with the default stream precision
+template<typename T>
+std::string toChars(T value)
+{
+    static_assert(isCharConvertible_v<T>);
+    auto buffer = std::array<char, 64>{};
+    const auto result = [&]
+    {
+        if constexpr (std::is_floating_point_v<T>)
+            return std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::general, 6);
+        else
+            return std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    }();
+    return {buffer.data(), result.ptr};
+}
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_CHARCONV_H
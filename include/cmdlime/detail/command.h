@@ -1,6 +1,7 @@
 #ifndef CMDLIME_COMMAND_H
 #define CMDLIME_COMMAND_H
 
+#include "configfield.h"
 #include "flag.h"
 #include "icommand.h"
 #include "icommandlinereader.h"
@@ -14,6 +15,8 @@
 #include <functional>
 #include <memory>
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
 namespace cmdlime::detail {
 
@@ -25,11 +28,16 @@ public:
         SubCommand
     };
 
-    Command(const std::string& name, InitializedOptional<TConfig>& commandCfg, CommandLineReaderPtr reader, Type type)
+    Command(
+            const std::string& name,
+            ConfigField<InitializedOptional<TConfig>> commandField,
+            CommandLineReaderPtr parentReader,
+            Type type)
         : info_(name, {}, {})
         , type_(type)
-        , cfg_(commandCfg)
-        , reader_{reader}
+        , commandField_(commandField)
+        , parentReader_{parentReader}
+        , readerName_{name}
     {
     }
 
@@ -49,21 +57,19 @@ public:
     }
 
 private:
-    CommandLineReadResult read(const std::vector<std::string>& commandLine) override
+    CommandLineReadResult read(
+            Config& cfg,
+            CommandLineView commandLine,
+            ReadErrorMode errorMode,
+            std::vector<ReadError>& errors,
+            std::pmr::memory_resource* memoryResource) override
     {
-        cfg_.emplace();
-        if (!reader_)
+        auto& commandCfg = commandField_(cfg);
+        commandCfg.emplace();
+        if (!makeConfigReader())
             return CommandLineReadResult::Completed;
 
-        reader_->setCommandName(commandName_);
-        reader_->setUsageInfoFormat(commandUsageInfoFormat_);
-        if (helpFlag_) {
-            reader_->addFlag(std::move(helpFlag_));
-            for (auto& command : reader_->options().commands())
-                command->enableHelpFlag();
-        }
-
-        return reader_->read(commandLine);
+        return reader_->read(*commandCfg, commandLine, errorMode, errors, memoryResource);
     }
 
     CommandLineReaderPtr configReader() const override
@@ -71,14 +77,42 @@ private:
         return reader_;
     }
 
+    //the command's options are registered on first use, so only the commands from the read command line are built
+    CommandLineReaderPtr makeConfigReader() override
+    {
+        if (reader_ || !parentReader_)
+            return reader_;
+
+        reader_ = parentReader_->makeNestedReader(readerName_);
+        reader_->setCommandName(commandName_);
+        reader_->setUsageInfoFormat(usageInfoFormat_);
+        if constexpr (std::is_aggregate_v<TConfig>)
+            [[maybe_unused]] auto cfg = TConfig{{reader_}};
+        else
+            [[maybe_unused]] auto cfg = TConfig{reader_};
+        if (isHelpFlagEnabled_)
+            addHelpFlag();
+        return reader_;
+    }
+
     void enableHelpFlag() override
     {
-        helpFlag_ = std::make_unique<detail::Flag>(
+        isHelpFlagEnabled_ = true;
+        if (reader_)
+            addHelpFlag();
+    }
+
+    void addHelpFlag()
+    {
+        auto helpFlag = std::make_unique<detail::Flag>(
                 NameFormat::name(reader_->format(), "help"),
                 std::string{},
                 helpFlagValue_,
                 detail::Flag::Type::Exit);
-        helpFlag_->info().addDescription("show usage info and exit");
+        helpFlag->info().addDescription("show usage info and exit");
+        reader_->addFlag(std::move(helpFlag));
+        for (auto& command : reader_->options().commands())
+            command->enableHelpFlag();
     }
 
     bool isHelpFlagSet() const override
@@ -91,9 +125,9 @@ private:
         return type_ == Type::SubCommand;
     }
 
-    bool hasValue() const override
+    bool hasValue(Config& cfg) const override
     {
-        return cfg_;
+        return commandField_(cfg).has_value();
     }
 
     std::string usageInfo() const override
@@ -103,6 +137,19 @@ private:
         return reader_->usageInfo();
     }
 
+    //the returned function shares the ownership of the command's reader, so it can be called by errors
+    //that outlive the command line reader
+    std::function<std::string()> usageInfoRenderer() const override
+    {
+        auto reader = reader_ ? parentReader_->nestedReader(readerName_) : nullptr;
+        return [reader]
+        {
+            if (!reader)
+                return std::string{};
+            return reader->usageInfo();
+        };
+    }
+
     std::string usageInfoDetailed() const override
     {
         if (!reader_)
@@ -112,28 +159,35 @@ private:
 
     void setUsageInfoFormat(const UsageInfoFormat& format) override
     {
-        commandUsageInfoFormat_ = format;
+        usageInfoFormat_ = format;
+        if (reader_)
+            reader_->setUsageInfoFormat(format);
     }
 
     void setCommandName(const std::string& parentCommandName) override
     {
         commandName_ = parentCommandName.empty() ? info_.name() : parentCommandName + " " + info_.name();
+        if (reader_)
+            reader_->setCommandName(commandName_);
     }
 
-    void validate() const override
+    void validate(Config& cfg, ReadErrorMode errorMode, std::vector<ReadError>& errors) const override
     {
-        if (reader_ && cfg_)
-            reader_->validate(info_.name());
+        auto& commandCfg = commandField_(cfg);
+        if (reader_ && commandCfg)
+            reader_->validate(*commandCfg, info_.name(), errorMode, errors);
     }
 
 private:
     OptionInfo info_;
     Type type_;
-    UsageInfoFormat commandUsageInfoFormat_;
-    InitializedOptional<TConfig>& cfg_;
+    ConfigField<InitializedOptional<TConfig>> commandField_;
+    CommandLineReaderPtr parentReader_;
+    std::string readerName_;
     CommandLineReaderPtr reader_;
     std::string commandName_;
-    std::unique_ptr<IFlag> helpFlag_;
+    UsageInfoFormat usageInfoFormat_;
+    bool isHelpFlagEnabled_ = false;
     bool helpFlagValue_ = false;
 };
 
@@ -2,6 +2,7 @@
 #define CMDLIME_COMMANDCREATOR_H
 
 #include "command.h"
+#include "configfield.h"
 #include "icommandlinereader.h"
 #include "initializedoptional.h"
 #include "nameformat.h"
@@ -22,17 +23,15 @@ public:
     CommandCreator(
             CommandLineReaderPtr reader,
             sfun::not_empty<const std::string&> varName,
-            InitializedOptional<TCfg>& commandValue,
+            ConfigField<InitializedOptional<TCfg>> commandField,
             typename Command<TCfg>::Type type = Command<TCfg>::Type::Normal)
         : reader_(reader)
-        , commandValue_(commandValue)
+        , commandField_(commandField)
     {
-        nestedReader_ = reader_ ? reader_->makeNestedReader(NameFormat::fullName(reader_->format(), varName))
-                                : CommandLineReaderPtr{};
         command_ = std::make_unique<Command<TCfg>>(
                 reader_ ? NameFormat::fullName(reader->format(), varName.get()) : varName.get(),
-                commandValue,
-                nestedReader_,
+                commandField,
+                reader_,
                 type);
     }
 
@@ -53,7 +52,7 @@ public:
         if (reader_)
             reader_->addValidator(std::make_unique<Validator<InitializedOptional<TCfg>>>(
                     *command_,
-                    commandValue_,
+                    commandField_,
                     std::move(validationFunc)));
         return *this;
     }
@@ -67,14 +66,13 @@ public:
                     std::is_constructible_v<TCfg, detail::CommandLineReaderPtr>,
                     "Non aggregate config objects must inherit cmdlime::Config constructors with 'using "
                     "Config::Config;'");
-        return InitializedOptional<TCfg>{nestedReader_};
+        return InitializedOptional<TCfg>{};
     }
 
 private:
     std::unique_ptr<Command<TCfg>> command_;
     CommandLineReaderPtr reader_;
-    CommandLineReaderPtr nestedReader_;
-    InitializedOptional<TCfg>& commandValue_;
+    ConfigField<InitializedOptional<TCfg>> commandField_;
 };
 
 } //namespace cmdlime::detail
@@ -0,0 +1,81 @@
+#ifndef CMDLIME_COMMANDLINEVIEW_H
+#define CMDLIME_COMMANDLINEVIEW_H
+
+#include "external/sfun/precondition.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cmdlime::detail {
+
+//non-owning view of the command line tokens, nested commands read subviews of the parent's command line
+class CommandLineView {
+public:
+    CommandLineView() = default;
+    CommandLineView(const std::string_view* data, std::size_t size)
+        : data_{data}
+        , size_{size}
+    {
+    }
+    CommandLineView(const std::vector<std::string_view>& cmdLine)
+        : data_{cmdLine.data()}
+        , size_{cmdLine.size()}
+    {
+    }
+
+    const std::string_view* begin() const
+    {
+        return data_;
+    }
+
+    const std::string_view* end() const
+    {
+        return data_ + size_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    std::string_view operator[](std::size_t index) const
+    {
+        return data_[index];
+    }
+
+    CommandLineView subView(std::size_t pos) const
+    {
+        sfun_precondition(pos <= size_);
+        return {data_ + pos, size_ - pos};
+    }
+
+private:
+    const std::string_view* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+//the token views reference argv or the strings of the passed command line, they aren't copied
+inline std::vector<std::string_view> makeCommandLine(int argc, char** argv)
+{
+    auto result = std::vector<std::string_view>{};
+    if (argc > 1)
+        result.reserve(static_cast<std::size_t>(argc - 1));
+    for (auto i = 1; i < argc; ++i)
+        result.emplace_back(argv[i]);
+    return result;
+}
+
+inline std::vector<std::string_view> makeCommandLine(const std::vector<std::string>& cmdLine)
+{
+    return {cmdLine.begin(), cmdLine.end()};
+}
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_COMMANDLINEVIEW_H
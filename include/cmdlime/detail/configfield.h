@@ -0,0 +1,17 @@
+#ifndef CMDLIME_CONFIGFIELD_H
+#define CMDLIME_CONFIGFIELD_H
+
+namespace cmdlime {
+class Config;
+}
+
+namespace cmdlime::detail {
+
+//returns the option's field in the passed config object,
+//options store it instead of a reference, so they can read values into any config object of the same type
+template<typename T>
+using ConfigField = T& (*)(Config&);
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_CONFIGFIELD_H
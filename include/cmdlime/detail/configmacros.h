@@ -4,12 +4,17 @@
 #include <optional>
 #include <vector>
 
-#define CMDLIME_PARAM(name, type) type name = param<&std::remove_pointer_t<decltype(this)>::name>(#name, #type)
-#define CMDLIME_PARAMLIST(name, type) type name = paramList<&std::remove_pointer_t<decltype(this)>::name>(#name, #type)
+//the type is passed as variadic arguments, so it can contain commas, e.g. std::array<int, 3>
+#define CMDLIME_PARAM(name, ...)                                                                                       \
+    __VA_ARGS__ name = param<&std::remove_pointer_t<decltype(this)>::name>(#name, #__VA_ARGS__)
+#define CMDLIME_PARAMLIST(name, ...)                                                                                   \
+    __VA_ARGS__ name = paramList<&std::remove_pointer_t<decltype(this)>::name>(#name, #__VA_ARGS__)
 #define CMDLIME_FLAG(name) bool name = flag<&std::remove_pointer_t<decltype(this)>::name>(#name)
 #define CMDLIME_EXITFLAG(name) bool name = exitFlag<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define CMDLIME_ARG(name, type) type name = arg<&std::remove_pointer_t<decltype(this)>::name>(#name, #type)
-#define CMDLIME_ARGLIST(name, type) type name = argList<&std::remove_pointer_t<decltype(this)>::name>(#name, #type)
+#define CMDLIME_ARG(name, ...)                                                                                         \
+    __VA_ARGS__ name = arg<&std::remove_pointer_t<decltype(this)>::name>(#name, #__VA_ARGS__)
+#define CMDLIME_ARGLIST(name, ...)                                                                                     \
+    __VA_ARGS__ name = argList<&std::remove_pointer_t<decltype(this)>::name>(#name, #__VA_ARGS__)
 #define CMDLIME_COMMAND(name, type)                                                                                    \
     cmdlime::detail::InitializedOptional<type> name = command<&std::remove_pointer_t<decltype(this)>::name>(#name)
 #define CMDLIME_SUBCOMMAND(name, type)                                                                                 \
@@ -1,6 +1,7 @@
 #ifndef CMDLIME_FLAG_H
 #define CMDLIME_FLAG_H
 
+#include "configfield.h"
 #include "iflag.h"
 #include "optioninfo.h"
 #include <cmdlime/customnames.h>
@@ -17,9 +18,17 @@ public:
         Exit
     };
 
+    Flag(std::string name, std::string shortName, ConfigField<bool> flagField, Type type)
+        : info_(std::move(name), std::move(shortName), {})
+        , flagField_(flagField)
+        , type_(type)
+    {
+    }
+
+    //flag that isn't stored in the config, like --help
     Flag(std::string name, std::string shortName, bool& flagValue, Type type)
         : info_(std::move(name), std::move(shortName), {})
-        , flagValue_(flagValue)
+        , flagValue_(&flagValue)
         , type_(type)
     {
     }
@@ -40,14 +49,14 @@ public:
     }
 
 private:
-    void set() override
+    void set(Config& cfg) override
     {
-        flagValue_ = true;
+        value(cfg) = true;
     }
 
-    bool isSet() const override
+    bool isSet(Config& cfg) const override
     {
-        return flagValue_;
+        return value(cfg);
     }
 
     bool isExitFlag() const override
@@ -55,9 +64,15 @@ private:
         return type_ == Type::Exit;
     }
 
+    bool& value(Config& cfg) const
+    {
+        return flagField_ ? flagField_(cfg) : *flagValue_;
+    }
+
 private:
     OptionInfo info_;
-    bool& flagValue_;
+    ConfigField<bool> flagField_ = nullptr;
+    bool* flagValue_ = nullptr;
     Type type_;
 };
 
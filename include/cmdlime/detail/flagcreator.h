@@ -1,6 +1,7 @@
 #ifndef CMDLIME_FLAGCREATOR_H
 #define CMDLIME_FLAGCREATOR_H
 
+#include "configfield.h"
 #include "flag.h"
 #include "icommandlinereader.h"
 #include "nameformat.h"
@@ -15,14 +16,14 @@ public:
     FlagCreator(
             CommandLineReaderPtr reader,
             sfun::not_empty<const std::string&> varName,
-            bool& flagValue,
+            ConfigField<bool> flagField,
             Flag::Type flagType = Flag::Type::Normal)
         : reader_(reader)
     {
         flag_ = std::make_unique<Flag>(
                 reader_ ? NameFormat::name(reader_->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::shortName(reader_->format(), varName.get()) : varName.get(),
-                flagValue,
+                flagField,
                 flagType);
     }
 
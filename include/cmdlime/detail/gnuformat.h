@@ -10,9 +10,7 @@
 #include <cmdlime/errors.h>
 #include <algorithm>
 #include <functional>
-#include <iomanip>
 #include <optional>
-#include <sstream>
 
 namespace cmdlime::detail {
 
@@ -21,14 +19,21 @@ class GNUParser : public Parser<formatType> {
     using Parser<formatType>::Parser;
     using FindMode = typename Parser<formatType>::FindMode;
 
+public:
+    static void checkNames(const Options& options)
+    {
+        checkLongNames(options);
+        checkShortNames(options);
+    }
+
+private:
     void preProcess() override
     {
-        checkNames();
         foundParam_.clear();
         foundParamPrefix_.clear();
     }
 
-    void process(const std::string& token) override
+    void process(std::string_view token) override
     {
         if (!foundParam_.empty()) {
             this->readParam(foundParam_, token);
@@ -45,83 +50,79 @@ class GNUParser : public Parser<formatType> {
     void postProcess() override
     {
         if (!foundParam_.empty())
-            throw ParsingError{"Parameter '" + foundParamPrefix_ + foundParam_ + "' value can't be empty"};
+            this->addError({ReadErrorType::EmptyParamValue, foundParamPrefix_, foundParam_});
     }
 
-    void processCommand(const std::string& commandStr)
+    void processCommand(std::string_view commandStr)
     {
         sfun_precondition(sfun::starts_with(commandStr, "--"));
 
         auto command = sfun::after(commandStr, "--").value();
         auto paramValue = std::optional<std::string_view>{};
-        if (command.find('=') != std::string::npos) {
+        if (command.find('=') != std::string_view::npos) {
             paramValue = sfun::after(command, "=");
             command = sfun::before(command, "=").value();
         }
 
-        if (isParamOrFlag(command) && !foundParam_.empty() &&
-            this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-            throw ParsingError{"Parameter '" + foundParamPrefix_ + foundParam_ + "' value can't be empty"};
-        if (this->findParam(command, FindMode::Name) || this->findParamList(command, FindMode::Name)) {
+        const auto option = this->findOption(command, FindMode::Name);
+        if (option && !foundParam_.empty())
+            this->addError({ReadErrorType::EmptyParamValue, foundParamPrefix_, foundParam_});
+        if (option.isParamOrParamList()) {
             if (paramValue.has_value())
-                this->readParam(command, std::string{paramValue.value()});
+                this->readParam(command, paramValue.value());
             else {
                 foundParam_ = command;
                 foundParamPrefix_ = "--";
             }
         }
-        else if (this->findFlag(command, FindMode::Name))
-            this->readFlag(command);
-        else if (this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-            throw ParsingError{"Encountered unknown parameter or flag '--" + std::string{command} + "'"};
+        else if (auto flag = option.flag())
+            this->readFlag(*flag);
+        else
+            this->addError({ReadErrorType::UnknownParamOrFlag, "--", std::string{command}});
     }
 
-    void processShortCommand(std::string command)
+    void processShortCommand(std::string_view token)
     {
-        sfun_precondition(sfun::starts_with(command, "-"));
+        sfun_precondition(sfun::starts_with(token, "-"));
 
-        auto possibleNumberArg = command;
-        command = sfun::after(command, "-").value();
+        const auto command = sfun::after(token, "-").value();
         if (isShortParamOrFlag(command)) {
-            if (!foundParam_.empty() && this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-                throw ParsingError{"Parameter '" + foundParamPrefix_ + foundParam_ + "' value can't be empty"};
+            if (!foundParam_.empty())
+                this->addError({ReadErrorType::EmptyParamValue, foundParamPrefix_, foundParam_});
             parseShortCommand(command);
         }
-        else if (isNumber(possibleNumberArg))
-            this->readArg(possibleNumberArg);
-        else if (this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-            throw ParsingError{"Encountered unknown parameter or flag '-" + command + "'"};
+        else if (isNumber(token))
+            this->readArg(token);
+        else
+            this->addError({ReadErrorType::UnknownParamOrFlag, "-", std::string{command}});
     }
 
-    void parseShortCommand(const std::string& command)
+    void parseShortCommand(std::string_view command)
     {
-        if (command.empty())
-            throw ParsingError{"Flags and parameters must have a name"};
-        auto paramValue = std::string{};
-        for (auto ch : command) {
-            auto opt = std::string{ch};
-            if (!foundParam_.empty())
-                paramValue += opt;
-            else if (this->findFlag(opt, FindMode::ShortName))
-                this->readFlag(opt);
-            else if (this->findParam(opt, FindMode::ShortName)) {
-                foundParam_ = opt;
-                foundParamPrefix_ = "-";
-            }
-            else if (this->findParamList(opt, FindMode::ShortName)) {
-                foundParam_ = opt;
+        if (command.empty()) {
+            this->fail({ReadErrorType::EmptyOptionName});
+            return;
+        }
+        for (auto i = std::size_t{}; i < command.size(); ++i) {
+            const auto option = this->findOption(command[i], FindMode::ShortName);
+            if (auto flag = option.flag())
+                this->readFlag(*flag);
+            else if (option.isParamOrParamList()) {
+                foundParam_.assign(1, command[i]);
                 foundParamPrefix_ = "-";
+                const auto paramValue = command.substr(i + 1);
+                if (!paramValue.empty()) {
+                    this->readParam(foundParam_, paramValue);
+                    foundParam_.clear();
+                }
+                return;
             }
-            else if (this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-                throw ParsingError{"Unknown option '" + opt + "' in command '-" + command + "'"};
-        }
-        if (!foundParam_.empty() && !paramValue.empty()) {
-            this->readParam(foundParam_, paramValue);
-            foundParam_.clear();
+            else
+                this->addError({ReadErrorType::UnknownShortOption, "-", std::string{command[i]}, std::string{command}});
         }
     }
 
-    void checkLongNames()
+    static void checkLongNames(const Options& options)
     {
         auto check = [](const OptionInfo& var, const std::string& varType)
         {
@@ -141,24 +142,27 @@ class GNUParser : public Parser<formatType> {
                             "' must consist of alphanumeric characters and hyphens"};
             }
         };
-        this->forEachParamInfo(
+        Parser<formatType>::forEachParamInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachParamListInfo(
+        Parser<formatType>::forEachParamListInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachFlagInfo(
+        Parser<formatType>::forEachFlagInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Flag");
                 });
     }
 
-    void checkShortNames()
+    static void checkShortNames(const Options& options)
     {
         auto check = [](const OptionInfo& var, const std::string& varType)
         {
@@ -170,44 +174,32 @@ class GNUParser : public Parser<formatType> {
                 throw ConfigError{
                         varType + "'s short name '" + var.shortName() + "' must be an alphanumeric character"};
         };
-        this->forEachParamInfo(
+        Parser<formatType>::forEachParamInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachParamListInfo(
+        Parser<formatType>::forEachParamListInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachFlagInfo(
+        Parser<formatType>::forEachFlagInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Flag");
                 });
     }
 
-    void checkNames()
-    {
-        checkLongNames();
-        checkShortNames();
-    }
-
-    bool isParamOrFlag(std::string_view str)
-    {
-        if (str.empty())
-            return false;
-        return this->findFlag(str, FindMode::Name) || this->findParam(str, FindMode::Name) ||
-                this->findParamList(str, FindMode::Name);
-    }
 
-    bool isShortParamOrFlag(const std::string& str)
+    bool isShortParamOrFlag(std::string_view str)
     {
         if (str.empty())
             return false;
-        auto opt = str.substr(0, 1);
-        return this->findFlag(opt, FindMode::ShortName) || this->findParam(opt, FindMode::ShortName) ||
-                this->findParamList(opt, FindMode::ShortName);
+        return static_cast<bool>(this->findOption(str.front(), FindMode::ShortName));
     }
 
 private:
@@ -242,48 +234,30 @@ class GNUOutputFormatter {
 public:
     static std::string paramUsageName(const IParam& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + " <" + param.info().valueName() + ">";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">]";
-        else
-            stream << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramListUsageName(const IParamList& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + " <" + param.info().valueName() + ">...";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">...]";
-        else
-            stream << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">...";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramDescriptionName(const IParam& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent);
-        if (!param.info().shortName().empty())
-            stream << "-" << param.info().shortName() << ", ";
-        else
-            stream << " "
-                   << "   ";
-        stream << "--" << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+        return shortNameDescription(param.info(), indent) + "--" + param.info().name() + " <" +
+                param.info().valueName() + ">";
     }
 
     static std::string paramListDescriptionName(const IParamList& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent);
-        if (!param.info().shortName().empty())
-            stream << "-" << param.info().shortName() << ", ";
-        else
-            stream << " "
-                   << "   ";
-        stream << "--" << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+        return shortNameDescription(param.info(), indent) + "--" + param.info().name() + " <" +
+                param.info().valueName() + ">";
     }
 
     static std::string paramPrefix()
@@ -293,22 +267,12 @@ public:
 
     static std::string flagUsageName(const IFlag& flag)
     {
-        auto stream = std::stringstream{};
-        stream << "[" << flagPrefix() << flag.info().name() << "]";
-        return stream.str();
+        return "[" + flagPrefix() + flag.info().name() + "]";
     }
 
     static std::string flagDescriptionName(const IFlag& flag, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent);
-        if (!flag.info().shortName().empty())
-            stream << "-" << flag.info().shortName() << ", ";
-        else
-            stream << " "
-                   << "   ";
-        stream << "--" << flag.info().name();
-        return stream.str();
+        return shortNameDescription(flag.info(), indent) + "--" + flag.info().name();
     }
 
     static std::string flagPrefix()
@@ -318,46 +282,37 @@ public:
 
     static std::string argUsageName(const IArg& arg)
     {
-        auto stream = std::stringstream{};
-        stream << "<" << arg.info().name() << ">";
-        return stream.str();
+        return "<" + arg.info().name() + ">";
     }
 
     static std::string argDescriptionName(const IArg& arg, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << arg.info().name() << "> (" << arg.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + arg.info().name() + "> (" + arg.info().valueName() + ")";
     }
 
     static std::string argListUsageName(const IArgList& argList)
     {
-        auto stream = std::stringstream{};
         if (argList.isOptional())
-            stream << "[" << argList.info().name() << "...]";
-        else
-            stream << "<" << argList.info().name() << "...>";
-        return stream.str();
+            return "[" + argList.info().name() + "...]";
+        return "<" + argList.info().name() + "...>";
     }
 
     static std::string argListDescriptionName(const IArgList& argList, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << argList.info().name() << "> (" << argList.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + argList.info().name() + "> (" + argList.info().valueName() + ")";
     }
 
     static std::string commandDescriptionName(const ICommand& command, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << command.info().name() << " [options]";
-        return stream.str();
+        return indentation(indent) + command.info().name() + " [options]";
+    }
+
+private:
+    static std::string shortNameDescription(const OptionInfo& info, int indent)
+    {
+        if (info.shortName().empty())
+            return alignedRight(" ", indent) + "   ";
+        return alignedRight("-", indent) + info.shortName() + ", ";
     }
 };
 
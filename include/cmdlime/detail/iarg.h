@@ -2,13 +2,20 @@
 #define CMDLIME_IARG_H
 
 #include "ioption.h"
+#include <memory_resource>
 #include <string>
+#include <string_view>
+
+namespace cmdlime {
+class Config;
+}
 
 namespace cmdlime::detail {
 
 class IArg : public IOption {
 public:
-    virtual void read(const std::string& data) = 0;
+    virtual bool read(Config& cfg, std::string_view data) = 0;
+    virtual void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) = 0;
 };
 
 } //namespace cmdlime::detail
@@ -2,15 +2,32 @@
 #define CMDLIME_IARGLIST_H
 
 #include "ioption.h"
+#include "listconversion.h"
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include <vector>
+
+namespace cmdlime {
+class Config;
+}
 
 namespace cmdlime::detail {
 class OptionInfo;
 
 class IArgList : public IOption {
 public:
-    virtual void read(const std::string& data) = 0;
-    virtual bool hasValue() const = 0;
+    //all values of the argument list are read at once, so they can be converted in parallel
+    virtual std::vector<ConversionFailure> read(
+            Config& cfg,
+            const std::pmr::vector<std::string_view>& values,
+            bool stopOnFirstFailure) = 0;
+    //sinks pass every element to the handler as soon as it's read, so their values aren't collected
+    virtual bool isSink() const = 0;
+    //returns false if the element can't be converted from the data
+    virtual bool read(Config& cfg, std::string_view data) = 0;
+    virtual void clear(Config& cfg) = 0;
+    virtual void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) = 0;
     virtual bool isOptional() const = 0;
     virtual std::string defaultValue() const = 0;
 };
@@ -1,9 +1,13 @@
 #ifndef CMDLIME_ICOMMAND_H
 #define CMDLIME_ICOMMAND_H
 
+#include "commandlineview.h"
 #include "icommandlinereader.h"
 #include "ioption.h"
+#include <cmdlime/readresult.h>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -14,17 +18,24 @@ class IConfig;
 
 class ICommand : public IOption {
 public:
-    virtual bool hasValue() const = 0;
+    virtual bool hasValue(Config& cfg) const = 0;
     virtual CommandLineReaderPtr configReader() const = 0;
-    virtual CommandLineReadResult read(const std::vector<std::string>& commandLine) = 0;
+    virtual CommandLineReaderPtr makeConfigReader() = 0;
+    virtual CommandLineReadResult read(
+            Config& cfg,
+            CommandLineView commandLine,
+            ReadErrorMode errorMode,
+            std::vector<ReadError>& errors,
+            std::pmr::memory_resource* memoryResource) = 0;
     virtual bool isSubCommand() const = 0;
     virtual void enableHelpFlag() = 0;
     virtual bool isHelpFlagSet() const = 0;
     virtual std::string usageInfo() const = 0;
+    virtual std::function<std::string()> usageInfoRenderer() const = 0;
     virtual std::string usageInfoDetailed() const = 0;
     virtual void setUsageInfoFormat(const UsageInfoFormat&) = 0;
     virtual void setCommandName(const std::string& parentCommandName) = 0;
-    virtual void validate() const = 0;
+    virtual void validate(Config& cfg, ReadErrorMode errorMode, std::vector<ReadError>& errors) const = 0;
 };
 
 } //namespace cmdlime::detail
@@ -2,14 +2,18 @@
 #define CMDLIME_ICOMMANDLINEREADER_H
 
 #include "commandlinereaderptr.h"
+#include "commandlineview.h"
 #include "external/sfun/interface.h"
 #include <cmdlime/format.h>
+#include <cmdlime/readresult.h>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
 namespace cmdlime {
 struct UsageInfoFormat;
+class Config;
 }
 
 namespace cmdlime::detail {
@@ -24,12 +28,20 @@ class IValidator;
 
 enum CommandLineReadResult {
     Completed,
-    StoppedOnExitFlag
+    StoppedOnExitFlag,
+    Failed
 };
 
 class ICommandLineReader : private sfun::interface<ICommandLineReader> {
 public:
-    virtual CommandLineReadResult read(const std::vector<std::string>& cmdLine) = 0;
+    //when reading fails, the errors are added to the passed list.
+    //If the memory resource is set, the parser state and the std::pmr fields of the config are allocated from it.
+    virtual CommandLineReadResult read(
+            Config& cfg,
+            CommandLineView cmdLine,
+            ReadErrorMode errorMode,
+            std::vector<ReadError>& errors,
+            std::pmr::memory_resource* memoryResource) = 0;
     virtual const std::string& versionInfo() const = 0;
     virtual std::string usageInfo() const = 0;
     virtual std::string usageInfoDetailed() const = 0;
@@ -42,11 +54,17 @@ public:
     virtual void setArgList(std::unique_ptr<IArgList> argList) = 0;
     virtual void addCommand(std::unique_ptr<ICommand> command) = 0;
     virtual void addValidator(std::unique_ptr<IValidator> validator) = 0;
-    virtual void validate(const std::string& commandName) const = 0;
+    virtual void validate(
+            Config& cfg,
+            const std::string& commandName,
+            ReadErrorMode errorMode,
+            std::vector<ReadError>& errors) const = 0;
     virtual const Options& options() const = 0;
     virtual Format format() const = 0;
     virtual bool shortNamesEnabled() const = 0;
     virtual CommandLineReaderPtr makeNestedReader(const std::string& name) = 0;
+    virtual std::shared_ptr<const ICommandLineReader> nestedReader(const std::string& name) const = 0;
+    virtual void checkSchema() = 0;
 
 protected:
     CommandLineReaderPtr makePtr()
@@ -3,13 +3,17 @@
 
 #include "ioption.h"
 
+namespace cmdlime {
+class Config;
+}
+
 namespace cmdlime::detail {
 class OptionInfo;
 
 class IFlag : public IOption {
 public:
-    virtual void set() = 0;
-    virtual bool isSet() const = 0;
+    virtual void set(Config& cfg) = 0;
+    virtual bool isSet(Config& cfg) const = 0;
     virtual bool isExitFlag() const = 0;
 };
 
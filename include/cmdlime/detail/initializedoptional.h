@@ -1,12 +1,16 @@
 #ifndef CMDLIME_INITIALIZEDOPTIONAL_H
 #define CMDLIME_INITIALIZEDOPTIONAL_H
 
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace cmdlime::detail {
 
+//optional storage of command configs, the config object is allocated only when the command is read,
+//so the configs of unused commands don't take space and aren't copied with the parent config
 template<typename T>
 class InitializedOptional {
 public:
@@ -14,27 +18,23 @@ public:
 
     InitializedOptional() = default;
     InitializedOptional(std::nullopt_t){};
-    template<typename... TArgs, std::enable_if_t<(sizeof...(TArgs) > 1)>* = nullptr>
-    InitializedOptional(TArgs&&... args)
-        : value_{std::forward<TArgs>(args)...}
+    InitializedOptional(const InitializedOptional& other)
+        : value_{other.value_ ? std::make_unique<T>(*other.value_) : nullptr}
     {
     }
-
-    template<
-            typename TArg,
-            std::enable_if_t<
-                    !std::is_base_of_v<InitializedOptional<T>, std::remove_reference_t<TArg>> &&
-                    !std::is_convertible_v<std::remove_reference_t<TArg>, InitializedOptional<T>>>* = nullptr>
-    InitializedOptional(TArg&& arg)
-        : value_{std::forward<TArg>(arg)}
+    InitializedOptional& operator=(const InitializedOptional& other)
     {
+        if (this != &other)
+            value_ = other.value_ ? std::make_unique<T>(*other.value_) : nullptr;
+        return *this;
     }
+    InitializedOptional(InitializedOptional&&) noexcept = default;
+    InitializedOptional& operator=(InitializedOptional&&) noexcept = default;
 
     template<class... Args>
     void emplace(Args&&... args)
     {
-        value_ = T{std::forward<Args>(args)...};
-        hasValue_ = true;
+        value_ = std::unique_ptr<T>{new T{std::forward<Args>(args)...}};
     }
 
     template<
@@ -44,77 +44,78 @@ public:
                     !std::is_same_v<std::nullopt_t, std::remove_cv_t<std::remove_reference_t<TArg>>>>* = nullptr>
     InitializedOptional& operator=(TArg&& arg)
     {
-        value_ = std::forward<TArg>(arg);
-        hasValue_ = true;
+        if (value_)
+            *value_ = std::forward<TArg>(arg);
+        else
+            value_ = std::make_unique<T>(std::forward<TArg>(arg));
         return *this;
     }
 
     void reset()
     {
-        hasValue_ = false;
+        value_.reset();
     }
 
     bool has_value() const
     {
-        return hasValue_;
+        return static_cast<bool>(value_);
     }
 
     operator bool() const
     {
-        return hasValue_;
+        return static_cast<bool>(value_);
     }
 
     T* operator->()
     {
-        if (!hasValue_)
+        if (!value_)
             throw std::bad_optional_access{};
-        return &value_;
+        return value_.get();
     }
 
     const T* operator->() const
     {
-        if (!hasValue_)
+        if (!value_)
             throw std::bad_optional_access{};
-        return &value_;
+        return value_.get();
     }
 
     T& operator*()
     {
-        if (!hasValue_)
+        if (!value_)
             throw std::bad_optional_access{};
-        return value_;
+        return *value_;
     }
 
     const T& operator*() const
     {
-        if (!hasValue_)
+        if (!value_)
             throw std::bad_optional_access{};
-        return value_;
+        return *value_;
     }
 
     T& value()
     {
-        if (!hasValue_)
+        if (!value_)
             throw std::bad_optional_access{};
-        return value_;
+        return *value_;
     }
 
     const T& value() const
     {
-        if (!hasValue_)
+        if (!value_)
             throw std::bad_optional_access{};
-        return value_;
+        return *value_;
     }
 
     template<typename U>
     T value_or(U&& defaultValue) const
     {
-        return hasValue_ ? value_ : static_cast<T>(std::forward<U>(defaultValue));
+        return value_ ? *value_ : static_cast<T>(std::forward<U>(defaultValue));
     }
 
 private:
-    T value_{};
-    bool hasValue_ = false;
+    std::unique_ptr<T> value_;
 };
 
 template<class T, class U>
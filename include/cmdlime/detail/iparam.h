@@ -2,15 +2,23 @@
 #define CMDLIME_IPARAM_H
 
 #include "ioption.h"
+#include <memory_resource>
 #include <string>
+#include <string_view>
+
+namespace cmdlime {
+class Config;
+}
 
 namespace cmdlime::detail {
 class OptionInfo;
 
 class IParam : public IOption {
 public:
-    virtual void read(const std::string& data) = 0;
-    virtual bool hasValue() const = 0;
+    //returns false if the value can't be converted from the data
+    virtual bool read(Config& cfg, std::string_view data) = 0;
+    //moves the field to the memory resource if it's a std::pmr container or string
+    virtual void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) = 0;
     virtual bool isOptional() const = 0;
     virtual std::string defaultValue() const = 0;
 };
@@ -2,15 +2,33 @@
 #define CMDLIME_IPARAMLIST_H
 
 #include "ioption.h"
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <string_view>
+
+namespace cmdlime {
+class Config;
+}
 
 namespace cmdlime::detail {
 class OptionInfo;
 
 class IParamList : public IOption {
 public:
-    virtual void read(const std::string& data) = 0;
-    virtual bool hasValue() const = 0;
+    //reads the elements of the value after the already read ones, their number is passed in size,
+    //returns the number of the found elements or an empty value if they can't be converted,
+    //then the details of the conversion error are stored in errorDetails
+    virtual std::optional<std::size_t> read(
+            Config& cfg,
+            std::string_view data,
+            std::size_t size,
+            std::string& errorDetails) = 0;
+    //returns the number of elements required by fixed size lists like std::array
+    virtual std::optional<std::size_t> fixedSize() const = 0;
+    virtual void clear(Config& cfg) = 0;
+    virtual void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) = 0;
     virtual bool isOptional() const = 0;
     virtual std::string defaultValue() const = 0;
 };
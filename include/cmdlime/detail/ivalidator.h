@@ -3,12 +3,19 @@
 
 #include "ioption.h"
 #include "external/sfun/interface.h"
+#include <cmdlime/readresult.h>
+#include <optional>
+#include <string>
+
+namespace cmdlime {
+class Config;
+}
 
 namespace cmdlime::detail {
 
 class IValidator : private sfun::interface<IValidator> {
 public:
-    virtual void validate(const std::string& commandName) const = 0;
+    virtual std::optional<ReadError> validate(Config& cfg, const std::string& commandName) const = 0;
     virtual OptionType optionType() const = 0;
 };
 
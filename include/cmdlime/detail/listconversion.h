@@ -0,0 +1,199 @@
+#ifndef CMDLIME_LISTCONVERSION_H
+#define CMDLIME_LISTCONVERSION_H
+
+#include "utils.h"
+#include <cmdlime/errors.h>
+#include <cmdlime/stringconverter.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <exception>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cmdlime::detail {
+
+//list element value that couldn't be converted, details contain the message of StringConversionError
+struct ConversionFailure {
+    std::size_t index;
+    std::string details;
+};
+
+//lists converted in parallel are resized first, so the threads can assign the elements in place,
+//containers returning proxies of their elements, like std::vector<bool>, can't be assigned concurrently
+template<typename T, typename = void>
+struct isParallelConvertible : std::false_type {};
+
+template<typename T>
+struct isParallelConvertible<
+        T,
+        std::void_t<decltype(std::declval<T&>().resize(std::size_t{})), decltype(std::declval<T&>()[std::size_t{}])>>
+    : std::bool_constant<
+              std::is_same_v<decltype(std::declval<T&>()[std::size_t{}]), typename T::value_type&> &&
+              std::is_default_constructible_v<typename T::value_type>> {};
+
+//returns an empty value if the data can't be converted, the details of StringConversionError are stored in errorDetails
+template<typename T>
+std::optional<T> tryConvertFromString(std::string_view data, std::string& errorDetails)
+{
+    try {
+        return convertFromString<T>(data);
+    }
+    catch (const StringConversionError& error) {
+        errorDetails = error.what();
+        return std::nullopt;
+    }
+}
+
+//returns the error details if the value can't be converted
+template<typename T>
+std::optional<std::string> convertTo(T& element, std::string_view value)
+{
+    auto errorDetails = std::string{};
+    auto result = tryConvertFromString<T>(value, errorDetails);
+    if (!result)
+        return errorDetails;
+    element = std::move(*result);
+    return std::nullopt;
+}
+
+template<typename TList, typename TAllocator>
+std::vector<ConversionFailure> appendConverted(
+        TList& list,
+        const std::vector<std::string_view, TAllocator>& values,
+        bool stopOnFirstFailure)
+{
+    if constexpr (isReservable<TList>::value)
+        list.reserve(list.size() + values.size());
+
+    auto failures = std::vector<ConversionFailure>{};
+    for (auto i = std::size_t{}; i < values.size(); ++i) {
+        try {
+            auto element = convertFromString<typename TList::value_type>(values[i]);
+            if (element) {
+                list.emplace_back(std::move(*element));
+                continue;
+            }
+            failures.push_back({i, {}});
+        }
+        catch (const StringConversionError& error) {
+            failures.push_back({i, error.what()});
+        }
+        if (stopOnFirstFailure)
+            break;
+    }
+    return failures;
+}
+
+//values are split into chunks converted on separate threads into the elements starting from pos,
+//the failures are returned ordered by the value index.
+//If the thread count isn't positive, std::thread::hardware_concurrency() is used.
+template<typename TList, typename TAllocator>
+std::vector<ConversionFailure> convertInParallel(
+        TList& list,
+        std::size_t pos,
+        const std::vector<std::string_view, TAllocator>& values,
+        int threadCount,
+        bool stopOnFirstFailure)
+{
+    //small chunks aren't worth starting a thread
+    const auto minChunkSize = std::size_t{256};
+    const auto maxChunkCount = threadCount > 0 ? static_cast<std::size_t>(threadCount)
+                                               : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const auto chunkCount = std::clamp(values.size() / minChunkSize, std::size_t{1}, maxChunkCount);
+    const auto chunkSize = (values.size() + chunkCount - 1) / chunkCount;
+
+    auto firstFailureIndex = std::atomic<std::size_t>{values.size()};
+    auto chunkFailures = std::vector<std::vector<ConversionFailure>>(chunkCount);
+    auto chunkExceptions = std::vector<std::exception_ptr>(chunkCount);
+    auto convertChunk = [&](std::size_t chunkIndex)
+    {
+        try {
+            const auto end = std::min(values.size(), (chunkIndex + 1) * chunkSize);
+            for (auto i = chunkIndex * chunkSize; i < end; ++i) {
+                if (stopOnFirstFailure && i > firstFailureIndex.load(std::memory_order_relaxed))
+                    return;
+                auto details = convertTo(list[pos + i], values[i]);
+                if (!details)
+                    continue;
+
+                chunkFailures[chunkIndex].push_back({i, std::move(*details)});
+                auto failureIndex = firstFailureIndex.load(std::memory_order_relaxed);
+                while (i < failureIndex && !firstFailureIndex.compare_exchange_weak(failureIndex, i)) {
+                }
+                if (stopOnFirstFailure)
+                    return;
+            }
+        }
+        catch (...) {
+            chunkExceptions[chunkIndex] = std::current_exception();
+        }
+    };
+
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(chunkCount - 1);
+    for (auto chunkIndex = std::size_t{1}; chunkIndex < chunkCount; ++chunkIndex) {
+        try {
+            threads.emplace_back(convertChunk, chunkIndex);
+        }
+        catch (const std::system_error&) {
+            convertChunk(chunkIndex);
+        }
+    }
+    convertChunk(0);
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& exception : chunkExceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+
+    auto failures = std::vector<ConversionFailure>{};
+    for (auto& chunk : chunkFailures)
+        std::move(chunk.begin(), chunk.end(), std::back_inserter(failures));
+    if (stopOnFirstFailure && failures.size() > 1)
+        failures.resize(1);
+    return failures;
+}
+
+//elements using polymorphic allocators are converted into temporaries allocated from the default memory resource,
+//as the memory resource of the list doesn't have to be thread-safe, and they're moved to the list on the calling thread
+template<typename TList, typename TAllocator>
+std::vector<ConversionFailure> appendConvertedInParallel(
+        TList& list,
+        const std::vector<std::string_view, TAllocator>& values,
+        int threadCount,
+        bool stopOnFirstFailure)
+{
+    static_assert(isParallelConvertible<TList>::value);
+    if (values.empty())
+        return {};
+
+    using Element = typename TList::value_type;
+    const auto pos = list.size();
+    if constexpr (std::uses_allocator_v<Element, std::pmr::polymorphic_allocator<std::byte>>) {
+        auto elements = std::vector<Element>(values.size());
+        auto failures = convertInParallel(elements, 0, values, threadCount, stopOnFirstFailure);
+        list.resize(pos + values.size());
+        for (auto i = std::size_t{}; i < elements.size(); ++i)
+            list[pos + i] = std::move(elements[i]);
+        return failures;
+    }
+    else {
+        list.resize(pos + values.size());
+        return convertInParallel(list, pos, values, threadCount, stopOnFirstFailure);
+    }
+}
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_LISTCONVERSION_H
@@ -0,0 +1,43 @@
+#ifndef CMDLIME_MEMORYRESOURCE_H
+#define CMDLIME_MEMORYRESOURCE_H
+
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cmdlime::detail {
+
+inline std::pmr::memory_resource* memoryResourceOrDefault(std::pmr::memory_resource* resource)
+{
+    return resource ? resource : std::pmr::get_default_resource();
+}
+
+//std::pmr containers and strings that can be moved to another memory resource without a chance of failing midway
+template<typename T, typename = void>
+struct usesPolymorphicAllocator : std::false_type {};
+
+template<typename T>
+struct usesPolymorphicAllocator<T, std::void_t<typename T::allocator_type, typename T::value_type>>
+    : std::bool_constant<
+              std::is_same_v<typename T::allocator_type, std::pmr::polymorphic_allocator<typename T::value_type>> &&
+              std::is_nothrow_move_constructible_v<T>> {};
+
+//the allocator of an existing container can't be replaced, so the value is moved into a copy using the memory resource
+//and constructed again from it
+template<typename T>
+void moveToMemoryResource(T& value, std::pmr::memory_resource& resource)
+{
+    if constexpr (usesPolymorphicAllocator<T>::value) {
+        if (value.get_allocator().resource()->is_equal(resource))
+            return;
+        auto movedValue = T(std::move(value), typename T::allocator_type{&resource});
+        value.~T();
+        ::new (static_cast<void*>(std::addressof(value))) T(std::move(movedValue));
+    }
+}
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_MEMORYRESOURCE_H
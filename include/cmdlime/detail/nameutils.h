@@ -3,7 +3,9 @@
 
 #include "external/sfun/string_utils.h"
 #include <algorithm>
+#include <cctype>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace cmdlime::detail {
@@ -96,12 +98,20 @@ inline std::string typeNameWithoutNamespace(const std::string& type)
     return std::string{type.begin() + static_cast<int>(pos + 1), type.end()};
 }
 
+//returns the first template argument, so the sizes of std::array or cmdlime::SmallVector aren't included.
+//Namespaces are removed from the type name beforehand, so the argument can be left without the opening bracket.
 inline std::string templateType(const std::string& type)
 {
-    auto result = sfun::between(type, "<", ">");
-    if (!result.has_value())
+    auto argument = std::string_view{type};
+    const auto argumentPos = argument.find('<');
+    if (argumentPos != std::string_view::npos)
+        argument.remove_prefix(argumentPos + 1);
+    argument = argument.substr(0, argument.find_first_of(",>"));
+    while (!argument.empty() && std::isspace(static_cast<unsigned char>(argument.back())))
+        argument.remove_suffix(1);
+    if (argument.empty())
         return type;
-    return std::string{result.value()};
+    return std::string{argument};
 }
 
 } //namespace cmdlime::detail
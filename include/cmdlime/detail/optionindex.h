@@ -0,0 +1,154 @@
+#ifndef CMDLIME_OPTIONINDEX_H
+#define CMDLIME_OPTIONINDEX_H
+
+#include "icommand.h"
+#include "iflag.h"
+#include "iparam.h"
+#include "iparamlist.h"
+#include "optioninfo.h"
+#include <array>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+
+namespace cmdlime::detail {
+
+enum class FindMode {
+    Name,
+    ShortName,
+    All
+};
+
+class OptionRef {
+public:
+    OptionRef() = default;
+    OptionRef(IParam& param)
+        : option_{&param}
+    {
+    }
+    OptionRef(IParamList& paramList)
+        : option_{&paramList}
+    {
+    }
+    OptionRef(IFlag& flag)
+        : option_{&flag}
+    {
+    }
+
+    IParam* param() const
+    {
+        return get<IParam>();
+    }
+
+    IParamList* paramList() const
+    {
+        return get<IParamList>();
+    }
+
+    IFlag* flag() const
+    {
+        return get<IFlag>();
+    }
+
+    bool isParamOrParamList() const
+    {
+        return param() || paramList();
+    }
+
+    explicit operator bool() const
+    {
+        return !std::holds_alternative<std::monostate>(option_);
+    }
+
+private:
+    template<typename T>
+    T* get() const
+    {
+        auto option = std::get_if<T*>(&option_);
+        return option ? *option : nullptr;
+    }
+
+private:
+    std::variant<std::monostate, IParam*, IParamList*, IFlag*> option_;
+};
+
+//keys are views of the indexed options' names, so options can't be renamed after they were added;
+//name conflicts are reported by the parser's names check, the first added option is kept here.
+//Commands are indexed separately, as their names are matched only with the positional arguments
+class OptionIndex {
+    struct Entry {
+        OptionRef option;
+        bool isShortName = false;
+    };
+
+public:
+    void add(OptionRef option, const OptionInfo& info)
+    {
+        addName(info.name(), Entry{option, false});
+        if (!info.shortName().empty())
+            addName(info.shortName(), Entry{option, true});
+    }
+
+    OptionRef find(std::string_view name, FindMode mode = FindMode::All) const
+    {
+        auto it = names_.find(name);
+        if (it == names_.end())
+            return {};
+        return select(it->second, mode);
+    }
+
+    void addCommand(ICommand& command)
+    {
+        commands_.emplace(command.info().name(), &command);
+    }
+
+    ICommand* findCommand(std::string_view name) const
+    {
+        auto it = commands_.find(name);
+        if (it == commands_.end())
+            return nullptr;
+        return it->second;
+    }
+
+    //single character lookup for short options bundles like -abc
+    OptionRef find(char name, FindMode mode = FindMode::All) const
+    {
+        const auto index = static_cast<unsigned char>(name);
+        if (index >= singleCharNames_.size())
+            return {};
+        return select(singleCharNames_[index], mode);
+    }
+
+private:
+    void addName(const std::string& name, const Entry& entry)
+    {
+        names_.emplace(name, entry);
+        if (name.size() != 1)
+            return;
+        const auto index = static_cast<unsigned char>(name.front());
+        if (index < singleCharNames_.size() && !singleCharNames_[index].option)
+            singleCharNames_[index] = entry;
+    }
+
+    static OptionRef select(const Entry& entry, FindMode mode)
+    {
+        switch (mode) {
+        case FindMode::Name:
+            return entry.isShortName ? OptionRef{} : entry.option;
+        case FindMode::ShortName:
+            return entry.isShortName ? entry.option : OptionRef{};
+        case FindMode::All:
+            return entry.option;
+        }
+        return {};
+    }
+
+private:
+    std::unordered_map<std::string_view, Entry> names_;
+    std::array<Entry, 128> singleCharNames_;
+    std::unordered_map<std::string_view, ICommand*> commands_;
+};
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_OPTIONINDEX_H
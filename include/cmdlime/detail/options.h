@@ -7,6 +7,7 @@
 #include "iflag.h"
 #include "iparam.h"
 #include "iparamlist.h"
+#include "optionindex.h"
 #include <memory>
 #include <vector>
 
@@ -44,18 +45,26 @@ public:
         return commands_;
     }
 
+    const OptionIndex& index() const
+    {
+        return index_;
+    }
+
     void addParam(std::unique_ptr<IParam> param)
     {
+        index_.add(*param, param->info());
         params_.emplace_back(std::move(param));
     }
 
     void addParamList(std::unique_ptr<IParamList> paramList)
     {
+        index_.add(*paramList, paramList->info());
         paramLists_.emplace_back(std::move(paramList));
     }
 
     void addFlag(std::unique_ptr<IFlag> flag)
     {
+        index_.add(*flag, flag->info());
         flags_.emplace_back(std::move(flag));
     }
 
@@ -71,6 +80,7 @@ public:
 
     void addCommand(std::unique_ptr<ICommand> command)
     {
+        index_.addCommand(*command);
         commands_.emplace_back(std::move(command));
     }
 
@@ -81,6 +91,7 @@ private:
     std::vector<std::unique_ptr<IArg>> args_;
     std::unique_ptr<IArgList> argList_;
     std::vector<std::unique_ptr<ICommand>> commands_;
+    OptionIndex index_;
 };
 
 } //namespace cmdlime::detail
@@ -1,7 +1,9 @@
 #ifndef CMDLIME_PARAM_H
 #define CMDLIME_PARAM_H
 
+#include "configfield.h"
 #include "iparam.h"
+#include "memoryresource.h"
 #include "optioninfo.h"
 #include "external/sfun/type_traits.h"
 #include <cmdlime/customnames.h>
@@ -10,23 +12,29 @@
 #include <functional>
 #include <memory>
 #include <optional>
-#include <sstream>
+#include <string>
 
 namespace cmdlime::detail {
 
 template<typename T>
 class Param : public IParam {
 public:
-    Param(std::string name, std::string shortName, std::string type, T& paramValue)
+    Param(std::string name, std::string shortName, std::string type, ConfigField<T> paramField)
         : info_(std::move(name), std::move(shortName), std::move(type))
-        , paramValue_(paramValue)
+        , paramField_(paramField)
     {
     }
 
+    //the default value is only shown in the usage info, so it's stored already converted to a string
     void setDefaultValue(const T& value)
     {
-        hasValue_ = true;
-        defaultValue_ = value;
+        auto valueStr = convertToString(value);
+        if (!valueStr)
+            defaultValue_ = std::string{};
+        else if (valueStr->empty())
+            defaultValue_ = "\"\"";
+        else
+            defaultValue_ = std::move(*valueStr);
     }
 
     OptionInfo& info() override
@@ -45,18 +53,18 @@ public:
     }
 
 private:
-    void read(const std::string& data) override
+    bool read(Config& cfg, std::string_view data) override
     {
-        paramValue_ = convertFromString<T>(data);
-        hasValue_ = true;
+        auto value = convertFromString<T>(data);
+        if (!value)
+            return false;
+        paramField_(cfg) = std::move(*value);
+        return true;
     }
 
-    bool hasValue() const override
+    void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) override
     {
-        if constexpr (sfun::is_optional_v<T>)
-            return true;
-        else
-            return hasValue_;
+        moveToMemoryResource(paramField_(cfg), resource);
     }
 
     bool isOptional() const override
@@ -69,21 +77,13 @@ private:
 
     std::string defaultValue() const override
     {
-        if (!defaultValue_)
-            return {};
-        auto defaultValueStr = convertToString(*defaultValue_);
-        if (!defaultValueStr)
-            return {};
-        if (defaultValueStr->empty())
-            return "\"\"";
-        return *defaultValueStr;
+        return defaultValue_.value_or(std::string{});
     }
 
 private:
     OptionInfo info_;
-    T& paramValue_;
-    std::optional<T> defaultValue_;
-    bool hasValue_ = false;
+    ConfigField<T> paramField_;
+    std::optional<std::string> defaultValue_;
 };
 
 } //namespace cmdlime::detail
@@ -1,6 +1,7 @@
 #ifndef CMDLIME_PARAMCREATOR_H
 #define CMDLIME_PARAMCREATOR_H
 
+#include "configfield.h"
 #include "icommandlinereader.h"
 #include "nameformat.h"
 #include "param.h"
@@ -16,15 +17,15 @@ public:
             CommandLineReaderPtr reader,
             sfun::not_empty<const std::string&> varName,
             sfun::not_empty<const std::string&> type,
-            T& paramValue)
+            ConfigField<T> paramField)
         : reader_(reader)
-        , paramValue_(paramValue)
+        , paramField_(paramField)
     {
         param_ = std::make_unique<Param<T>>(
                 reader_ ? NameFormat::name(reader->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::shortName(reader->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::valueName(reader->format(), type.get()) : varName.get(),
-                paramValue);
+                paramField);
     }
 
     auto& operator<<(const std::string& info)
@@ -62,7 +63,7 @@ public:
     auto& operator<<(std::function<void(const T&)> validationFunc)
     {
         if (reader_)
-            reader_->addValidator(std::make_unique<Validator<T>>(*param_, paramValue_, std::move(validationFunc)));
+            reader_->addValidator(std::make_unique<Validator<T>>(*param_, paramField_, std::move(validationFunc)));
         return *this;
     }
 
@@ -84,7 +85,7 @@ private:
     std::unique_ptr<Param<T>> param_;
     T defaultValue_;
     CommandLineReaderPtr reader_;
-    T& paramValue_;
+    ConfigField<T> paramField_;
 };
 
 } //namespace cmdlime::detail
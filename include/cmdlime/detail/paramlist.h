@@ -1,35 +1,52 @@
 #ifndef CMDLIME_PARAMLIST_H
 #define CMDLIME_PARAMLIST_H
 
+#include "configfield.h"
 #include "iparamlist.h"
+#include "listconversion.h"
+#include "memoryresource.h"
 #include "optioninfo.h"
-#include "external/sfun/string_utils.h"
+#include "utils.h"
 #include "external/sfun/type_traits.h"
 #include <cmdlime/customnames.h>
 #include <cmdlime/errors.h>
 #include <cmdlime/stringconverter.h>
+#include <algorithm>
 #include <functional>
 #include <memory>
-#include <sstream>
+#include <optional>
+#include <string>
+#include <tuple>
 #include <vector>
 
 namespace cmdlime::detail {
 
 template<typename TParamList>
 class ParamList : public IParamList {
-    static_assert(sfun::is_dynamic_sequence_container_v<TParamList>, "Param list field must be a sequence container");
+    static_assert(
+            sfun::is_dynamic_sequence_container_v<TParamList> || isStdArray<TParamList>::value,
+            "Param list field must be a sequence container or std::array");
 
 public:
-    ParamList(std::string name, std::string shortName, std::string type, TParamList& paramListValue)
+    ParamList(std::string name, std::string shortName, std::string type, ConfigField<TParamList> paramListField)
         : info_(std::move(name), std::move(shortName), std::move(type))
-        , paramListValue_(paramListValue)
+        , paramListField_(paramListField)
     {
     }
 
+    void setParallelConversion(int threadCount)
+    {
+        parallelConversionThreadCount_ = threadCount;
+    }
+
+    void setDelimiter(std::string delimiter)
+    {
+        delimiter_ = std::move(delimiter);
+    }
+
     void setDefaultValue(const TParamList& value)
     {
-        hasValue_ = true;
-        defaultValue_ = value;
+        defaultValue_ = toString(value);
     }
 
     OptionInfo& info() override
@@ -48,24 +65,135 @@ public:
     }
 
 private:
-    void read(const std::string& data) override
+    std::optional<std::size_t> read(
+            Config& cfg,
+            std::string_view data,
+            std::size_t size,
+            std::string& errorDetails) override
+    {
+        auto& paramListValue = paramListField_(cfg);
+        if constexpr (isStdArray<TParamList>::value)
+            return readToArray(paramListValue, data, size, errorDetails);
+        else
+            return readToContainer(paramListValue, data, errorDetails);
+    }
+
+    std::optional<std::size_t> fixedSize() const override
     {
-        if (!isDefaultValueOverwritten_) {
-            paramListValue_.clear();
-            isDefaultValueOverwritten_ = true;
+        if constexpr (isStdArray<TParamList>::value)
+            return std::tuple_size_v<TParamList>;
+        else
+            return std::nullopt;
+    }
+
+    //elements that don't fit into the array are only counted, so the parser can report the wrong number of elements
+    std::optional<std::size_t> readToArray(
+            TParamList& paramListValue,
+            std::string_view data,
+            std::size_t size,
+            std::string& errorDetails)
+    {
+        auto count = std::size_t{};
+        while (!data.empty()) {
+            const auto part = popElement(data);
+            if (part.empty())
+                continue;
+
+            if (size + count < paramListValue.size()) {
+                auto paramVal = tryConvertFromString<typename TParamList::value_type>(part, errorDetails);
+                if (!paramVal)
+                    return std::nullopt;
+                paramListValue[size + count] = std::move(*paramVal);
+            }
+            ++count;
+        }
+        return count;
+    }
+
+    std::optional<std::size_t> readToContainer(
+            TParamList& paramListValue,
+            std::string_view data,
+            std::string& errorDetails)
+    {
+        if constexpr (isParallelConvertible<TParamList>::value)
+            if (parallelConversionThreadCount_)
+                return readInParallel(paramListValue, data, errorDetails);
+
+        if constexpr (isReservable<TParamList>::value) {
+            //the capacity is grown at least twice, so the lists filled by repeated parameters don't reallocate every time
+            const auto size = paramListValue.size() + maxElementCount(data);
+            if (size > paramListValue.capacity())
+                paramListValue.reserve(std::max(size, paramListValue.capacity() * 2));
         }
 
-        const auto dataParts = sfun::split(data, ",");
-        for (const auto& part : dataParts) {
-            auto paramVal = convertFromString<typename TParamList::value_type>(std::string{part});
-            paramListValue_.emplace_back(std::move(paramVal));
+        auto count = std::size_t{};
+        while (!data.empty()) {
+            const auto part = popElement(data);
+            if (part.empty())
+                continue;
+
+            auto paramVal = tryConvertFromString<typename TParamList::value_type>(part, errorDetails);
+            if (!paramVal)
+                return std::nullopt;
+            paramListValue.emplace_back(std::move(*paramVal));
+            ++count;
         }
-        hasValue_ = true;
+        return count;
     }
 
-    bool hasValue() const override
+    std::optional<std::size_t> readInParallel(
+            TParamList& paramListValue,
+            std::string_view data,
+            std::string& errorDetails)
     {
-        return hasValue_;
+        auto values = std::vector<std::string_view>{};
+        values.reserve(maxElementCount(data));
+        while (!data.empty()) {
+            const auto part = popElement(data);
+            if (!part.empty())
+                values.push_back(part);
+        }
+
+        const auto failures =
+                appendConvertedInParallel(paramListValue, values, *parallelConversionThreadCount_, true);
+        if (failures.empty())
+            return values.size();
+        errorDetails = std::move(failures.front().details);
+        return std::nullopt;
+    }
+
+    //elements are trimmed, so the parts consisting only of whitespace are skipped like the empty ones
+    std::string_view popElement(std::string_view& data) const
+    {
+        const auto delimiterPos = data.find(delimiter_);
+        const auto element = data.substr(0, delimiterPos);
+        data.remove_prefix(delimiterPos == std::string_view::npos ? data.size() : delimiterPos + delimiter_.size());
+        return trimmed(element);
+    }
+
+    std::size_t maxElementCount(std::string_view data) const
+    {
+        if (delimiter_.size() == 1)
+            return static_cast<std::size_t>(std::count(data.begin(), data.end(), delimiter_.front())) + 1;
+
+        auto count = std::size_t{1};
+        for (auto pos = data.find(delimiter_); pos != std::string_view::npos;
+             pos = data.find(delimiter_, pos + delimiter_.size()))
+            ++count;
+        return count;
+    }
+
+    void clear(Config& cfg) override
+    {
+        if constexpr (isStdArray<TParamList>::value)
+            paramListField_(cfg) = TParamList{};
+        else
+            paramListField_(cfg).clear();
+    }
+
+    void useMemoryResource(Config& cfg, std::pmr::memory_resource& resource) override
+    {
+        moveToMemoryResource(paramListField_(cfg), resource);
     }
 
     bool isOptional() const override
@@ -75,35 +203,37 @@ private:
 
     std::string defaultValue() const override
     {
-        if (!defaultValue_)
-            return {};
-        auto stream = std::stringstream{};
-        stream << "{";
+        return defaultValue_.value_or(std::string{});
+    }
+
+    static std::string toString(const TParamList& value)
+    {
+        auto result = std::string{"{"};
         auto firstVal = true;
-        for (auto& val : *defaultValue_) {
+        for (auto& val : value) {
             auto valStr = convertToString(val);
             if (!valStr)
                 return {};
 
             if (!firstVal)
-                stream << ", ";
+                result += ", ";
             firstVal = false;
 
             if (valStr->empty())
-                stream << "\"\"";
+                result += "\"\"";
             else
-                stream << *valStr;
+                result += *valStr;
         }
-        stream << "}";
-        return stream.str();
+        result += "}";
+        return result;
     }
 
 private:
     OptionInfo info_;
-    TParamList& paramListValue_;
-    bool hasValue_ = false;
-    std::optional<TParamList> defaultValue_;
-    bool isDefaultValueOverwritten_ = false;
+    ConfigField<TParamList> paramListField_;
+    std::optional<std::string> defaultValue_;
+    std::string delimiter_ = ",";
+    std::optional<int> parallelConversionThreadCount_;
 };
 
 } //namespace cmdlime::detail
@@ -1,6 +1,7 @@
 #ifndef CMDLIME_PARAMLISTCREATOR_H
 #define CMDLIME_PARAMLISTCREATOR_H
 
+#include "configfield.h"
 #include "icommandlinereader.h"
 #include "nameformat.h"
 #include "paramlist.h"
@@ -12,22 +13,24 @@ namespace cmdlime::detail {
 
 template<typename TParamList>
 class ParamListCreator {
-    static_assert(sfun::is_dynamic_sequence_container_v<TParamList>, "Param list field must be a sequence container");
+    static_assert(
+            sfun::is_dynamic_sequence_container_v<TParamList> || isStdArray<TParamList>::value,
+            "Param list field must be a sequence container or std::array");
 
 public:
     ParamListCreator(
             CommandLineReaderPtr reader,
             sfun::not_empty<const std::string&> varName,
             sfun::not_empty<const std::string&> type,
-            TParamList& paramListValue)
+            ConfigField<TParamList> paramListField)
         : reader_(reader)
-        , paramListValue_(paramListValue)
+        , paramListField_(paramListField)
     {
         paramList_ = std::make_unique<ParamList<TParamList>>(
                 reader_ ? NameFormat::name(reader_->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::shortName(reader_->format(), varName.get()) : varName.get(),
                 reader_ ? NameFormat::valueName(reader_->format(), type.get()) : type.get(),
-                paramListValue);
+                paramListField);
     }
 
     auto& operator<<(const std::string& info)
@@ -62,11 +65,26 @@ public:
         return *this;
     }
 
+    auto& operator<<(const Delimiter& delimiter)
+    {
+        paramList_->setDelimiter(delimiter.value());
+        return *this;
+    }
+
+    auto& operator<<(const ParallelConversion& parallelConversion)
+    {
+        static_assert(
+                isParallelConvertible<TParamList>::value,
+                "Parallel conversion requires a resizable random access container of default constructible elements");
+        paramList_->setParallelConversion(parallelConversion.threadCount);
+        return *this;
+    }
+
     auto& operator<<(std::function<void(const TParamList&)> validationFunc)
     {
         if (reader_)
             reader_->addValidator(
-                    std::make_unique<Validator<TParamList>>(*paramList_, paramListValue_, std::move(validationFunc)));
+                    std::make_unique<Validator<TParamList>>(*paramList_, paramListField_, std::move(validationFunc)));
         return *this;
     }
 
@@ -88,7 +106,7 @@ private:
     std::unique_ptr<ParamList<TParamList>> paramList_;
     TParamList defaultValue_;
     CommandLineReaderPtr reader_;
-    TParamList& paramListValue_;
+    ConfigField<TParamList> paramListField_;
 };
 
 } //namespace cmdlime::detail
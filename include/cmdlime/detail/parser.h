@@ -1,6 +1,7 @@
 #ifndef CMDLIME_PARSER_H
 #define CMDLIME_PARSER_H
 
+#include "commandlineview.h"
 #include "formatcfg.h"
 #include "iarg.h"
 #include "iarglist.h"
@@ -8,13 +9,21 @@
 #include "iflag.h"
 #include "iparam.h"
 #include "iparamlist.h"
+#include "memoryresource.h"
+#include "optionindex.h"
 #include "options.h"
 #include <cmdlime/errors.h>
+#include <cmdlime/readresult.h>
 #include <algorithm>
+#include <cstddef>
 #include <deque>
 #include <functional>
+#include <iterator>
+#include <memory_resource>
 #include <optional>
 #include <string_view>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -23,45 +32,40 @@ namespace cmdlime::detail {
 
 template<Format formatType>
 class Parser {
-protected:
-    enum class ReadMode {
-        All,
-        Args,
-        Commands,
-        ExitFlagsAndCommands,
-    };
-
-private:
     using OutputFormatter = typename FormatCfg<formatType>::outputFormatter;
 
-    class ReadModeScope {
-    public:
-        ReadModeScope(ReadMode value, ReadMode& readMode)
-            : readMode_(readMode)
-        {
-            originalValue_ = readMode_;
-            readMode_ = value;
-        }
-        ~ReadModeScope()
-        {
-            readMode_ = originalValue_;
-        }
-
-    private:
-        ReadMode& readMode_;
-        ReadMode originalValue_;
+    //parameter or argument value found during the command line scan, it's applied only
+    //if the command line doesn't contain a command or an exit flag
+    struct ValueRead {
+        OptionRef param;
+        std::string_view value;
+        std::size_t tokenIndex;
     };
 
 public:
-    explicit Parser(const Options& options)
+    //the state of the parsing is allocated from the memory resource, if it's set, the config fields using
+    //polymorphic allocators are moved to it too
+    Parser(
+            const Options& options,
+            Config& cfg,
+            ReadErrorMode errorMode = ReadErrorMode::StopOnFirstError,
+            std::pmr::memory_resource* memoryResource = nullptr)
         : options_(options)
+        , cfg_(cfg)
+        , memoryResource_(memoryResource)
+        , argsToRead_(memoryResourceOrDefault(memoryResource))
+        , valueReads_(memoryResourceOrDefault(memoryResource))
+        , argListValues_(memoryResourceOrDefault(memoryResource))
+        , argListTokenIndices_(memoryResourceOrDefault(memoryResource))
+        , readOptions_(memoryResourceOrDefault(memoryResource))
+        , paramListSizes_(memoryResourceOrDefault(memoryResource))
+        , errorMode_(errorMode)
     {
     }
     virtual ~Parser() = default;
 
-    CommandLineReadResult parse(const std::vector<std::string>& cmdLine)
+    CommandLineReadResult parse(CommandLineView cmdLine)
     {
-        checkNames();
         argsToRead_.clear();
 
         std::transform(
@@ -73,297 +77,363 @@ public:
                     return *arg;
                 });
 
-        auto readResult = readCommandsAndExitFlags(cmdLine);
-        if (readResult)
-            return *readResult;
-
+        if (memoryResource_)
+            moveFieldsToMemoryResource(*memoryResource_);
         preProcess();
-        auto argsDelimiterEncountered = false;
-        for (auto i = 0u; i < cmdLine.size(); ++i) {
-            const auto& token = cmdLine.at(i);
+        auto commandPos = cmdLine.size();
+        for (auto i = std::size_t{}; i < cmdLine.size(); ++i) {
+            const auto token = cmdLine[i];
+            tokenIndex_ = i;
             if (token == "--") {
-                argsDelimiterEncountered = true;
+                argsDelimiterEncountered_ = true;
                 continue;
             }
-            if (!argsDelimiterEncountered) {
+            if (argsDelimiterEncountered_)
+                readArg(token);
+            else {
                 process(token);
+                if (isStopped())
+                    return CommandLineReadResult::Failed;
                 if (foundCommand_) {
-                    readCommand(foundCommand_, {cmdLine.begin() + i + 1, cmdLine.end()});
+                    commandPos = i;
                     break;
                 }
             }
-            else {
-                auto modeGuard = setScopeReadMode(ReadMode::Args);
-                readArg(token);
-            }
         }
+
+        if (foundCommand_ && !foundCommand_->isSubCommand())
+            return readCommand(foundCommand_, cmdLine.subView(commandPos + 1), commandPos + 1);
+        if (!foundCommand_ && !argsDelimiterEncountered_ && isExitFlagSet() && errors_.empty())
+            return CommandLineReadResult::StoppedOnExitFlag;
+
         postProcess();
+        applyValueReads();
+        if (isStopped())
+            return CommandLineReadResult::Failed;
+        reportDeferredErrors();
+        if (isStopped())
+            return CommandLineReadResult::Failed;
+        if (foundCommand_) {
+            readCommand(foundCommand_, cmdLine.subView(commandPos + 1), commandPos + 1);
+            if (isStopped())
+                return CommandLineReadResult::Failed;
+        }
 
+        tokenIndex_ = std::nullopt;
         checkUnreadParams();
         checkUnreadArgs();
         checkUnreadArgList();
-        return CommandLineReadResult::Completed;
+        return errors_.empty() ? CommandLineReadResult::Completed : CommandLineReadResult::Failed;
     }
 
-protected:
-    enum class FindMode {
-        Name,
-        ShortName,
-        All
-    };
-    IParam* findParam(std::string_view name, FindMode mode = FindMode::All)
+    std::vector<ReadError>& errors()
     {
-        auto paramIt = std::find_if(
-                options_.params().begin(),
-                options_.params().end(),
-                [&](auto& param)
-                {
-                    switch (mode) {
-                    case FindMode::Name:
-                        return param->info().name() == name;
-                    case FindMode::ShortName:
-                        return param->info().shortName() == name;
-                    case FindMode::All:
-                        return param->info().name() == name || param->info().shortName() == name;
-                    default:
-                        return false;
-                    }
-                });
-        if (paramIt == options_.params().end())
-            return nullptr;
-        return paramIt->get();
+        return errors_;
     }
 
-    IParamList* findParamList(std::string_view name, FindMode mode = FindMode::All)
+    //schema checks don't depend on the command line, readers run them once per set of options
+    static void checkUniqueNames(const Options& options)
     {
-        auto paramListIt = std::find_if(
-                options_.paramLists().begin(),
-                options_.paramLists().end(),
-                [&](auto& paramList)
-                {
-                    switch (mode) {
-                    case FindMode::Name:
-                        return paramList->info().name() == name;
-                    case FindMode::ShortName:
-                        return paramList->info().shortName() == name;
-                    case FindMode::All:
-                        return paramList->info().name() == name || paramList->info().shortName() == name;
-                    default:
-                        return false;
-                    }
-                });
-        if (paramListIt == options_.paramLists().end())
-            return nullptr;
-        return paramListIt->get();
+        auto encounteredNames = std::unordered_set<std::string_view>{};
+
+        auto processName = [&encounteredNames](const std::string& varType, const OptionInfo& var)
+        {
+            if (encounteredNames.count(var.name()))
+                throw ConfigError{varType + " name '" + var.name() + "' is already used."};
+            encounteredNames.insert(var.name());
+            if (var.shortName().empty())
+                return;
+            if (encounteredNames.count(var.shortName()))
+                throw ConfigError{varType + " short name '" + var.shortName() + "' is already used."};
+            encounteredNames.insert(var.shortName());
+        };
+        for (auto& param : options.params())
+            processName("Parameter's", param->info());
+        for (auto& paramList : options.paramLists())
+            processName("Parameter's", paramList->info());
+        for (auto& flag : options.flags())
+            processName("Flag's", flag->info());
     }
 
-    void readParam(std::string_view name, const std::string& value)
+protected:
+    using FindMode = detail::FindMode;
+
+    OptionRef findOption(std::string_view name, FindMode mode = FindMode::All) const
     {
-        if (readMode_ != ReadMode::All)
-            return;
+        return options_.index().find(name, mode);
+    }
 
-        if (value.empty())
-            throw ParsingError{
-                    "Parameter '" + OutputFormatter::paramPrefix() + std::string{name} + "' value can't be empty"};
-        auto param = findParam(name);
-        if (param) {
-            try {
-                param->read(value);
-            }
-            catch (const StringConversionError& error) {
-                const auto errorMessage = std::string_view{error.what()};
-                throw ParsingError{
-                        "Couldn't set parameter '" + OutputFormatter::paramPrefix() + param->info().name() +
-                        "' value from '" + value + "'" +
-                        (!errorMessage.empty() ? ": " + std::string{errorMessage} : std::string{})};
-            }
+    OptionRef findOption(char name, FindMode mode = FindMode::All) const
+    {
+        return options_.index().find(name, mode);
+    }
+
+    void readParam(std::string_view name, std::string_view value)
+    {
+        if (value.empty()) {
+            addError({ReadErrorType::EmptyParamValue, OutputFormatter::paramPrefix(), std::string{name}});
             return;
         }
-        auto paramList = findParamList(name);
-        if (paramList) {
-            try {
-                paramList->read(value);
-            }
-            catch (const StringConversionError& error) {
-                const auto errorMessage = std::string_view{error.what()};
-                throw ParsingError{
-                        "Couldn't set parameter '" + OutputFormatter::paramPrefix() + paramList->info().name() +
-                        "' value from '" + value + "'" +
-                        (!errorMessage.empty() ? ": " + std::string{errorMessage} : std::string{})};
-            }
+        const auto option = findOption(name);
+        if (!option.isParamOrParamList()) {
+            addError({ReadErrorType::UnknownParam, OutputFormatter::paramPrefix(), std::string{name}});
             return;
         }
-        throw ParsingError{
-                "Encountered unknown parameter '" + OutputFormatter::paramPrefix() + std::string{name} + "'"};
+        if (deferredErrors_.empty() || errorMode_ == ReadErrorMode::CollectAllErrors)
+            valueReads_.push_back({option, value, *tokenIndex_});
     }
 
-    IFlag* findFlag(std::string_view name, FindMode mode = FindMode::All)
+    IFlag* findFlag(std::string_view name, FindMode mode = FindMode::All) const
     {
-        auto flagIt = std::find_if(
-                options_.flags().begin(),
-                options_.flags().end(),
-                [&](auto& flag)
-                {
-                    switch (mode) {
-                    case FindMode::Name:
-                        return flag->info().name() == name;
-                    case FindMode::ShortName:
-                        return flag->info().shortName() == name;
-                    case FindMode::All:
-                        return flag->info().name() == name || flag->info().shortName() == name;
-                    default:
-                        return false;
-                    }
-                });
-        if (flagIt == options_.flags().end())
-            return nullptr;
-        return flagIt->get();
+        return findOption(name, mode).flag();
     }
 
     void readFlag(std::string_view name)
     {
-        if (readMode_ != ReadMode::ExitFlagsAndCommands && readMode_ != ReadMode::All)
+        auto flag = findFlag(name);
+        if (!flag) {
+            fail({ReadErrorType::UnknownFlag, OutputFormatter::flagPrefix(), std::string{name}});
             return;
+        }
+        readFlag(*flag);
+    }
 
-        auto flag = findFlag(name);
-        if (!flag)
-            throw ParsingError{"Encountered unknown flag '" + OutputFormatter::flagPrefix() + std::string{name} + "'"};
-        flag->set();
+    void readFlag(IFlag& flag)
+    {
+        flag.set(cfg_);
     }
 
-    void readArg(const std::string& value)
+    void readArg(std::string_view value)
     {
-        if (readMode_ == ReadMode::All || readMode_ == ReadMode::ExitFlagsAndCommands ||
-            readMode_ == ReadMode::Commands) {
+        if (!argsDelimiterEncountered_) {
             foundCommand_ = findCommand(value);
             if (foundCommand_)
                 return;
         }
-        if (readMode_ != ReadMode::Args && readMode_ != ReadMode::All)
+        if (deferredErrors_.empty() || errorMode_ == ReadErrorMode::CollectAllErrors)
+            valueReads_.push_back({OptionRef{}, value, *tokenIndex_});
+    }
+
+    //registers an error which is reported only if the command line doesn't contain a command or an exit flag,
+    //parsing continues to find them
+    void addError(ReadError error)
+    {
+        if (!deferredErrors_.empty() && errorMode_ == ReadErrorMode::StopOnFirstError)
             return;
+        ReadErrorAccess::setTokenIndex(error, tokenIndex_);
+        deferredErrors_.push_back(std::move(error));
+    }
 
-        if (!argsToRead_.empty()) {
-            auto& arg = static_cast<IArg&>(argsToRead_.front());
-            if (value.empty())
-                throw ParsingError{"Argument '" + arg.info().name() + "' value can't be empty"};
-            argsToRead_.pop_front();
-            try {
-                arg.read(value);
-            }
-            catch (const StringConversionError& error) {
-                const auto errorMessage = std::string_view{error.what()};
-                throw ParsingError{
-                        "Couldn't set argument '" + arg.info().name() + "' value from '" + value + "'" +
-                        (!errorMessage.empty() ? ": " + std::string{errorMessage} : std::string{})};
-            }
-        }
-        else if (options_.argList()) {
-            if (value.empty())
-                throw ParsingError{
-                        "Argument list '" + options_.argList()->info().name() + "' element value can't be empty"};
-            try {
-                options_.argList()->read(value);
-            }
-            catch (const StringConversionError& error) {
-                const auto errorMessage = std::string_view{error.what()};
-                throw ParsingError{
-                        "Couldn't set argument list '" + options_.argList()->info().name() +
-                        "' element's value from '" + value + "'" +
-                        (!errorMessage.empty() ? ": " + std::string{errorMessage} : std::string{})};
-            }
-        }
-        else
-            throw ParsingError("Encountered unknown positional argument '" + value + "'");
+    //registers an error which stops the parsing, unless all errors are collected
+    void fail(ReadError error)
+    {
+        ReadErrorAccess::setTokenIndex(error, tokenIndex_);
+        errors_.push_back(std::move(error));
     }
 
-    void forEachParamInfo(const std::function<void(const OptionInfo&)>& handler)
+    static void forEachParamInfo(const Options& options, const std::function<void(const OptionInfo&)>& handler)
     {
-        for (auto& param : options_.params())
+        for (auto& param : options.params())
             handler(param->info());
     }
 
-    void forEachParamListInfo(const std::function<void(const OptionInfo&)>& handler)
+    static void forEachParamListInfo(const Options& options, const std::function<void(const OptionInfo&)>& handler)
     {
-        for (auto& paramList : options_.paramLists())
+        for (auto& paramList : options.paramLists())
             handler(paramList->info());
     }
 
-    void forEachFlagInfo(const std::function<void(const OptionInfo&)>& handler)
+    static void forEachFlagInfo(const Options& options, const std::function<void(const OptionInfo&)>& handler)
     {
-        for (auto& flag : options_.flags())
+        for (auto& flag : options.flags())
             handler(flag->info());
     }
 
 private:
     virtual void preProcess() {}
-    virtual void process(const std::string& cmdLineToken) = 0;
+    virtual void process(std::string_view cmdLineToken) = 0;
     virtual void postProcess() {}
 
-    ICommand* findCommand(const std::string& name)
+    ICommand* findCommand(std::string_view name) const
     {
-        auto commandIt = std::find_if(
-                options_.commands().begin(),
-                options_.commands().end(),
-                [&](auto& command)
+        return options_.index().findCommand(name);
+    }
+
+    bool isStopped() const
+    {
+        return errorMode_ == ReadErrorMode::StopOnFirstError && !errors_.empty();
+    }
+
+    //errors of the found tokens are ordered by their position in the command line
+    void reportDeferredErrors()
+    {
+        std::move(deferredErrors_.begin(), deferredErrors_.end(), std::back_inserter(errors_));
+        deferredErrors_.clear();
+        sortErrors();
+    }
+
+    void sortErrors()
+    {
+        std::stable_sort(
+                errors_.begin(),
+                errors_.end(),
+                [](const ReadError& lhs, const ReadError& rhs)
                 {
-                    return command->info().name() == name;
+                    return lhs.tokenIndex() < rhs.tokenIndex();
                 });
-        if (commandIt == options_.commands().end())
-            return nullptr;
-        return commandIt->get();
     }
 
-    CommandLineReadResult readCommand(ICommand* command, const std::vector<std::string>& cmdLine)
+    void moveFieldsToMemoryResource(std::pmr::memory_resource& resource)
     {
-        try {
-            return command->read(cmdLine);
+        for (auto& param : options_.params())
+            param->useMemoryResource(cfg_, resource);
+        for (auto& paramList : options_.paramLists())
+            paramList->useMemoryResource(cfg_, resource);
+        for (auto& arg : options_.args())
+            arg->useMemoryResource(cfg_, resource);
+        if (auto argList = options_.argList())
+            argList->useMemoryResource(cfg_, resource);
+    }
+
+    CommandLineReadResult readCommand(ICommand* command, CommandLineView cmdLine, std::size_t commandLinePos)
+    {
+        auto commandErrors = std::vector<ReadError>{};
+        const auto result = command->read(cfg_, cmdLine, errorMode_, commandErrors, memoryResource_);
+        if (commandErrors.empty())
+            return errors_.empty() ? result : CommandLineReadResult::Failed;
+
+        const auto usageInfoRenderer = command->usageInfoRenderer();
+        for (auto& error : commandErrors) {
+            ReadErrorAccess::setCommand(error, usageInfoRenderer, command->info().name(), commandLinePos);
+            errors_.push_back(std::move(error));
         }
-        catch (const ConfigError& error) {
-            throw CommandConfigError(command->info().name(), command->usageInfo(), error);
+        return errors_.empty() ? result : CommandLineReadResult::Failed;
+    }
+
+    void applyValueReads()
+    {
+        for (const auto& valueRead : valueReads_) {
+            tokenIndex_ = valueRead.tokenIndex;
+            if (auto param = valueRead.param.param()) {
+                readOptions_.insert(param);
+                applyParamValue(*param, valueRead.value);
+            }
+            else if (auto paramList = valueRead.param.paramList()) {
+                if (readOptions_.insert(paramList).second)
+                    paramList->clear(cfg_);
+                applyParamListValue(*paramList, valueRead.value);
+            }
+            else
+                applyArgValue(valueRead.value);
+            if (isStopped())
+                break;
         }
-        catch (const ParsingError& error) {
-            throw CommandParsingError(command->info().name(), command->usageInfo(), error);
+        applyArgListValues();
+    }
+
+    //argument list values are converted together after the other values are applied,
+    //their errors are placed among the other errors by the token position
+    void applyArgListValues()
+    {
+        auto argList = options_.argList();
+        if (!argList || argListValues_.empty())
+            return;
+
+        const auto stopOnFirstFailure = errorMode_ == ReadErrorMode::StopOnFirstError;
+        auto failures = argList->read(cfg_, argListValues_, stopOnFirstFailure);
+        for (auto& failure : failures) {
+            auto error = ReadError{
+                    ReadErrorType::InvalidArgListValue,
+                    {},
+                    argList->info().name(),
+                    std::string{argListValues_[failure.index]},
+                    std::move(failure.details)};
+            ReadErrorAccess::setTokenIndex(error, argListTokenIndices_[failure.index]);
+            errors_.push_back(std::move(error));
+        }
+
+        if (stopOnFirstFailure && errors_.size() > 1) {
+            sortErrors();
+            errors_.erase(std::next(errors_.begin()), errors_.end());
         }
     }
 
-    std::optional<CommandLineReadResult> readCommandsAndExitFlags(const std::vector<std::string>& cmdLine)
+    template<typename TOption>
+    void readValue(TOption& option, std::string_view value, ReadErrorType errorType, const std::string& optionPrefix)
     {
-        auto modeGuard = setScopeReadMode(ReadMode::ExitFlagsAndCommands);
+        try {
+            if (!option.read(cfg_, value))
+                fail({errorType, optionPrefix, option.info().name(), std::string{value}});
+        }
+        catch (const StringConversionError& error) {
+            fail({errorType, optionPrefix, option.info().name(), std::string{value}, error.what()});
+        }
+    }
 
-        preProcess();
-        for (auto i = 0u; i < cmdLine.size(); ++i) {
-            const auto& token = cmdLine.at(i);
-            if (token == "--")
-                return {};
-
-            process(token);
-            if (foundCommand_) {
-                if (foundCommand_->isSubCommand()) {
-                    foundCommand_ = nullptr;
-                    return {};
-                }
-                else {
-                    auto res = readCommand(foundCommand_, {cmdLine.begin() + i + 1, cmdLine.end()});
-                    foundCommand_ = nullptr;
-                    return res;
-                }
-            }
+    void applyParamValue(IParam& param, std::string_view value)
+    {
+        readValue(param, value, ReadErrorType::InvalidParamValue, OutputFormatter::paramPrefix());
+    }
+
+    void applyParamListValue(IParamList& paramList, std::string_view value)
+    {
+        const auto& name = paramList.info().name();
+        auto& size = paramListSizes_[&paramList];
+        auto errorDetails = std::string{};
+        const auto readSize = paramList.read(cfg_, value, size, errorDetails);
+        if (!readSize) {
+            fail({ReadErrorType::InvalidParamValue,
+                  OutputFormatter::paramPrefix(),
+                  name,
+                  std::string{value},
+                  std::move(errorDetails)});
+            return;
         }
-        if (isExitFlagSet())
-            return CommandLineReadResult::StoppedOnExitFlag;
+        size += *readSize;
 
-        return {};
+        const auto fixedSize = paramList.fixedSize();
+        if (fixedSize && size > *fixedSize)
+            fail(wrongParamListSizeError(paramList));
     }
 
-    ReadModeScope setScopeReadMode(ReadMode value)
+    ReadError wrongParamListSizeError(const IParamList& paramList)
     {
-        return ReadModeScope{value, readMode_};
+        return {ReadErrorType::WrongParamListSize,
+                OutputFormatter::paramPrefix(),
+                paramList.info().name(),
+                std::to_string(paramList.fixedSize().value_or(0))};
+    }
+
+    void applyArgValue(std::string_view value)
+    {
+        if (!argsToRead_.empty()) {
+            auto& arg = static_cast<IArg&>(argsToRead_.front());
+            argsToRead_.pop_front();
+            if (value.empty())
+                fail({ReadErrorType::EmptyArgValue, {}, arg.info().name()});
+            else
+                readValue(arg, value, ReadErrorType::InvalidArgValue, {});
+        }
+        else if (auto argList = options_.argList()) {
+            if (readOptions_.insert(argList).second)
+                argList->clear(cfg_);
+            if (value.empty())
+                fail({ReadErrorType::EmptyArgListValue, {}, argList->info().name()});
+            else if (argList->isSink())
+                readValue(*argList, value, ReadErrorType::InvalidArgListValue, {});
+            else {
+                argListValues_.push_back(value);
+                argListTokenIndices_.push_back(*tokenIndex_);
+            }
+        }
+        else
+            fail({ReadErrorType::UnknownArg, {}, {}, std::string{value}});
     }
 
     bool isExitFlagSet()
     {
         for (const auto& flag : options_.flags())
-            if (flag->isSet() && flag->isExitFlag())
+            if (flag->isExitFlag() && flag->isSet(cfg_))
                 return true;
         return false;
     }
@@ -371,60 +441,53 @@ private:
     void checkUnreadParams()
     {
         for (const auto& param : options_.params())
-            if (!param->hasValue())
-                throw ParsingError{
-                        "Parameter '" + OutputFormatter::paramPrefix() + param->info().name() + "' is missing."};
+            if (!isStopped() && !param->isOptional() && !readOptions_.count(param.get()))
+                fail({ReadErrorType::MissingParam, OutputFormatter::paramPrefix(), param->info().name()});
 
-        for (const auto& paramList : options_.paramLists())
-            if (!paramList->hasValue())
-                throw ParsingError{
-                        "Parameter '" + OutputFormatter::paramPrefix() + paramList->info().name() + "' is missing."};
+        for (const auto& paramList : options_.paramLists()) {
+            if (isStopped())
+                return;
+            if (!readOptions_.count(paramList.get())) {
+                if (!paramList->isOptional())
+                    fail({ReadErrorType::MissingParam, OutputFormatter::paramPrefix(), paramList->info().name()});
+            }
+            else if (paramList->fixedSize() && paramListSizes_[paramList.get()] != *paramList->fixedSize())
+                fail(wrongParamListSizeError(*paramList));
+        }
     }
 
     void checkUnreadArgs()
     {
-        if (!argsToRead_.empty())
-            throw ParsingError{"Positional argument '" + argsToRead_.front().get().info().name() + "' is missing."};
+        for (const auto& arg : argsToRead_)
+            if (!isStopped())
+                fail({ReadErrorType::MissingArg, {}, arg.get().info().name()});
     }
 
     void checkUnreadArgList()
     {
-        if (options_.argList() && !options_.argList()->hasValue())
-            throw ParsingError{"Arguments list '" + options_.argList()->info().name() + "' is missing."};
+        auto argList = options_.argList();
+        if (!isStopped() && argList && !argList->isOptional() && !readOptions_.count(argList))
+            fail({ReadErrorType::MissingArgList, {}, argList->info().name()});
     }
 
-    void checkNames()
-    {
-        auto encounteredNames = std::unordered_set<std::string>{};
-
-        auto processName = [&encounteredNames](const std::string& varType, const OptionInfo& var)
-        {
-            if (encounteredNames.count(var.name()))
-                throw ConfigError{varType + " name '" + var.name() + "' is already used."};
-            encounteredNames.insert(var.name());
-            if (var.shortName().empty())
-                return;
-            if (encounteredNames.count(var.shortName()))
-                throw ConfigError{varType + " short name '" + var.shortName() + "' is already used."};
-            encounteredNames.insert(var.shortName());
-        };
-        for (auto& param : options_.params())
-            processName("Parameter's", param->info());
-        for (auto& paramList : options_.paramLists())
-            processName("Parameter's", paramList->info());
-        for (auto& flag : options_.flags())
-            processName("Flag's", flag->info());
-    }
-
-protected:
-    ReadMode readMode_ = ReadMode::All;
-
 private:
     const Options& options_;
-    std::deque<std::reference_wrapper<IArg>> argsToRead_;
+    Config& cfg_;
+    std::pmr::memory_resource* memoryResource_;
+    std::pmr::deque<std::reference_wrapper<IArg>> argsToRead_;
+    std::pmr::vector<ValueRead> valueReads_;
+    std::pmr::vector<std::string_view> argListValues_;
+    std::pmr::vector<std::size_t> argListTokenIndices_;
+    std::pmr::unordered_set<const IOption*> readOptions_;
+    std::pmr::unordered_map<const IParamList*, std::size_t> paramListSizes_;
+    ReadErrorMode errorMode_;
+    std::vector<ReadError> errors_;
+    std::vector<ReadError> deferredErrors_;
+    std::optional<std::size_t> tokenIndex_;
     ICommand* foundCommand_ = nullptr;
+    bool argsDelimiterEncountered_ = false;
 };
 
 } //namespace cmdlime::detail
 
-#endif //CMDLIME_PARSER_H
\ No newline at end of file
+#endif //CMDLIME_PARSER_H
@@ -10,8 +10,6 @@
 #include <cmdlime/errors.h>
 #include <algorithm>
 #include <functional>
-#include <iomanip>
-#include <sstream>
 
 namespace cmdlime::detail {
 
@@ -19,37 +17,64 @@ template<Format formatType>
 class PosixParser : public Parser<formatType> {
     using Parser<formatType>::Parser;
 
-    void processCommand(std::string command)
+public:
+    static void checkNames(const Options& options)
+    {
+        auto check = [](const OptionInfo& var, const std::string& varType)
+        {
+            if (var.name().size() != 1)
+                throw ConfigError{varType + "'s name '" + var.name() + "' can't have more than one symbol"};
+            if (!std::isalnum(var.name().front()))
+                throw ConfigError{varType + "'s name '" + var.name() + "' must be an alphanumeric character"};
+        };
+        Parser<formatType>::forEachParamInfo(
+                options,
+                [check](const OptionInfo& var)
+                {
+                    check(var, "Parameter");
+                });
+        Parser<formatType>::forEachParamListInfo(
+                options,
+                [check](const OptionInfo& var)
+                {
+                    check(var, "Parameter");
+                });
+        Parser<formatType>::forEachFlagInfo(
+                options,
+                [check](const OptionInfo& var)
+                {
+                    check(var, "Flag");
+                });
+    }
+
+private:
+    void processCommand(std::string_view token)
     {
-        sfun_precondition(sfun::starts_with(command, "-"));
+        sfun_precondition(sfun::starts_with(token, "-"));
 
-        auto possibleNumberArg = command;
-        command = sfun::after(command, "-").value();
+        const auto command = sfun::after(token, "-").value();
         if (isParamOrFlag(command)) {
-            if (this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands) {
-                if (!foundParam_.empty())
-                    throw ParsingError{"Parameter '-" + foundParam_ + "' value can't be empty"};
-                if (argumentEncountered_)
-                    throw ParsingError{"Flags and parameters must precede arguments"};
-            }
+            if (!foundParam_.empty())
+                this->addError({ReadErrorType::EmptyParamValue, "-", foundParam_});
+            if (argumentEncountered_)
+                this->addError({ReadErrorType::OptionsAfterArgs});
             parseCommand(command);
         }
-        else if (isNumber(possibleNumberArg)) {
-            this->readArg(possibleNumberArg);
+        else if (isNumber(token)) {
+            this->readArg(token);
             argumentEncountered_ = true;
         }
-        else if (this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-            throw ParsingError{"Encountered unknown parameter or flag '-" + command + "'"};
+        else
+            this->addError({ReadErrorType::UnknownParamOrFlag, "-", std::string{command}});
     }
 
     void preProcess() override
     {
-        checkNames();
         argumentEncountered_ = false;
         foundParam_.clear();
     }
 
-    void process(const std::string& token) override
+    void process(std::string_view token) override
     {
         if (!foundParam_.empty()) {
             this->readParam(foundParam_, token);
@@ -66,63 +91,39 @@ class PosixParser : public Parser<formatType> {
     void postProcess() override
     {
         if (!foundParam_.empty())
-            throw ParsingError{"Parameter '-" + foundParam_ + "' value can't be empty"};
+            this->addError({ReadErrorType::EmptyParamValue, "-", foundParam_});
     }
 
-    void parseCommand(const std::string& command)
+    void parseCommand(std::string_view command)
     {
-        if (command.empty())
-            throw ParsingError{"Flags and parameters must have a name"};
-        auto paramValue = std::string{};
-        for (auto ch : command) {
-            auto opt = std::string{ch};
-            if (!foundParam_.empty())
-                paramValue += opt;
-            else if (this->findFlag(opt))
-                this->readFlag(opt);
-            else if (this->findParam(opt) || this->findParamList(opt))
-                foundParam_ = opt;
-            else if (this->readMode_ != Parser<formatType>::ReadMode::ExitFlagsAndCommands)
-                throw ParsingError{"Unknown option '" + opt + "' in command '-" + command + "'"};
+        if (command.empty()) {
+            this->fail({ReadErrorType::EmptyOptionName});
+            return;
         }
-        if (!foundParam_.empty() && !paramValue.empty()) {
-            this->readParam(foundParam_, paramValue);
-            foundParam_.clear();
+        for (auto i = std::size_t{}; i < command.size(); ++i) {
+            const auto option = this->findOption(command[i]);
+            if (auto flag = option.flag())
+                this->readFlag(*flag);
+            else if (option.isParamOrParamList()) {
+                foundParam_.assign(1, command[i]);
+                const auto paramValue = command.substr(i + 1);
+                if (!paramValue.empty()) {
+                    this->readParam(foundParam_, paramValue);
+                    foundParam_.clear();
+                }
+                return;
+            }
+            else
+                this->addError({ReadErrorType::UnknownShortOption, "-", std::string{command[i]}, std::string{command}});
         }
     }
 
-    void checkNames()
-    {
-        auto check = [](const OptionInfo& var, const std::string& varType)
-        {
-            if (var.name().size() != 1)
-                throw ConfigError{varType + "'s name '" + var.name() + "' can't have more than one symbol"};
-            if (!std::isalnum(var.name().front()))
-                throw ConfigError{varType + "'s name '" + var.name() + "' must be an alphanumeric character"};
-        };
-        this->forEachParamInfo(
-                [check](const OptionInfo& var)
-                {
-                    check(var, "Parameter");
-                });
-        this->forEachParamListInfo(
-                [check](const OptionInfo& var)
-                {
-                    check(var, "Parameter");
-                });
-        this->forEachFlagInfo(
-                [check](const OptionInfo& var)
-                {
-                    check(var, "Flag");
-                });
-    }
 
-    bool isParamOrFlag(const std::string& str)
+    bool isParamOrFlag(std::string_view str)
     {
         if (str.empty())
             return false;
-        auto opt = str.substr(0, 1);
-        return this->findFlag(opt) || this->findParam(opt) || this->findParamList(opt);
+        return static_cast<bool>(this->findOption(str.front()));
     }
 
 private:
@@ -157,36 +158,28 @@ class PosixOutputFormatter {
 public:
     static std::string paramUsageName(const IParam& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + " <" + param.info().valueName() + ">";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">]";
-        else
-            stream << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramListUsageName(const IParamList& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + " <" + param.info().valueName() + ">...";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">...]";
-        else
-            stream << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">...";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramDescriptionName(const IParam& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+        return alignedRight(paramPrefix(), indent) + param.info().name() + " <" + param.info().valueName() + ">";
     }
 
     static std::string paramListDescriptionName(const IParamList& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+        return alignedRight(paramPrefix(), indent) + param.info().name() + " <" + param.info().valueName() + ">";
     }
 
     static std::string paramPrefix()
@@ -196,16 +189,12 @@ public:
 
     static std::string flagUsageName(const IFlag& flag)
     {
-        auto stream = std::stringstream{};
-        stream << "[" << flagPrefix() << flag.info().name() << "]";
-        return stream.str();
+        return "[" + flagPrefix() + flag.info().name() + "]";
     }
 
     static std::string flagDescriptionName(const IFlag& flag, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << flagPrefix() << flag.info().name();
-        return stream.str();
+        return alignedRight(flagPrefix(), indent) + flag.info().name();
     }
 
     static std::string flagPrefix()
@@ -215,46 +204,29 @@ public:
 
     static std::string argUsageName(const IArg& arg)
     {
-        auto stream = std::stringstream{};
-        stream << "<" << arg.info().name() << ">";
-        return stream.str();
+        return "<" + arg.info().name() + ">";
     }
 
     static std::string argDescriptionName(const IArg& arg, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << arg.info().name() << "> (" << arg.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + arg.info().name() + "> (" + arg.info().valueName() + ")";
     }
 
     static std::string argListUsageName(const IArgList& argList)
     {
-        auto stream = std::stringstream{};
         if (argList.isOptional())
-            stream << "[" << argList.info().name() << "...]";
-        else
-            stream << "<" << argList.info().name() << "...>";
-        return stream.str();
+            return "[" + argList.info().name() + "...]";
+        return "<" + argList.info().name() + "...>";
     }
 
     static std::string argListDescriptionName(const IArgList& argList, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << argList.info().name() << "> (" << argList.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + argList.info().name() + "> (" + argList.info().valueName() + ")";
     }
 
     static std::string commandDescriptionName(const ICommand& command, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << command.info().name() << " [options]";
-        return stream.str();
+        return indentation(indent) + command.info().name() + " [options]";
     }
 };
 
@@ -10,8 +10,6 @@
 #include <cmdlime/errors.h>
 #include <algorithm>
 #include <functional>
-#include <iomanip>
-#include <sstream>
 
 namespace cmdlime::detail {
 
@@ -19,35 +17,8 @@ template<Format formatType>
 class DefaultParser : public Parser<formatType> {
     using Parser<formatType>::Parser;
 
-    void preProcess() override
-    {
-        checkNames();
-    }
-
-    void process(const std::string& token) override
-    {
-        if (sfun::starts_with(token, "--") && token.size() > 2) {
-            const auto flagName = sfun::after(token, "--").value();
-            this->readFlag(flagName);
-        }
-        else if (sfun::starts_with(token, "-") && token.size() > 1) {
-            if (isNumber(token)) {
-                this->readArg(token);
-                return;
-            }
-
-            if (token.find('=') == std::string::npos)
-                throw ParsingError{"Wrong parameter format: " + token + ". Parameter must have a form of -name=value"};
-
-            const auto paramName = sfun::between(token, "-", "=").value();
-            const auto paramValue = std::string{sfun::after(token, "=").value()};
-            this->readParam(paramName, paramValue);
-        }
-        else
-            this->readArg(token);
-    }
-
-    void checkNames()
+public:
+    static void checkNames(const Options& options)
     {
         auto check = [](const OptionInfo& var, const std::string& varType)
         {
@@ -65,22 +36,51 @@ class DefaultParser : public Parser<formatType> {
                     throw ConfigError{varType + "'s name '" + var.name() + "' must consist of alphanumeric characters"};
             }
         };
-        this->forEachParamInfo(
+        Parser<formatType>::forEachParamInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachParamListInfo(
+        Parser<formatType>::forEachParamListInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachFlagInfo(
+        Parser<formatType>::forEachFlagInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Flag");
                 });
     }
+
+private:
+    void process(std::string_view token) override
+    {
+        if (sfun::starts_with(token, "--") && token.size() > 2) {
+            const auto flagName = sfun::after(token, "--").value();
+            this->readFlag(flagName);
+        }
+        else if (sfun::starts_with(token, "-") && token.size() > 1) {
+            if (isNumber(token)) {
+                this->readArg(token);
+                return;
+            }
+
+            if (token.find('=') == std::string_view::npos) {
+                this->fail({ReadErrorType::WrongParamFormat, {}, {}, std::string{token}});
+                return;
+            }
+
+            const auto paramName = sfun::between(token, "-", "=").value();
+            const auto paramValue = sfun::after(token, "=").value();
+            this->readParam(paramName, paramValue);
+        }
+        else
+            this->readArg(token);
+    }
 };
 
 class DefaultNameProvider {
@@ -110,36 +110,28 @@ class DefaultOutputFormatter {
 public:
     static std::string paramUsageName(const IParam& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + "=<" + param.info().valueName() + ">";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << "=<" << param.info().valueName() << ">]";
-        else
-            stream << paramPrefix() << param.info().name() << "=<" << param.info().valueName() << ">";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramListUsageName(const IParamList& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + "=<" + param.info().valueName() + ">...";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << "=<" << param.info().valueName() << ">...]";
-        else
-            stream << paramPrefix() << param.info().name() << "=<" << param.info().valueName() << ">...";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramDescriptionName(const IParam& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << paramPrefix() << param.info().name() << "=<" << param.info().valueName() << ">";
-        return stream.str();
+        return alignedRight(paramPrefix(), indent) + param.info().name() + "=<" + param.info().valueName() + ">";
     }
 
     static std::string paramListDescriptionName(const IParamList& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << paramPrefix() << param.info().name() << "=<" << param.info().valueName() << ">";
-        return stream.str();
+        return alignedRight(paramPrefix(), indent) + param.info().name() + "=<" + param.info().valueName() + ">";
     }
 
     static std::string paramPrefix()
@@ -149,16 +141,12 @@ public:
 
     static std::string flagUsageName(const IFlag& flag)
     {
-        auto stream = std::stringstream{};
-        stream << "[" << flagPrefix() << flag.info().name() << "]";
-        return stream.str();
+        return "[" + flagPrefix() + flag.info().name() + "]";
     }
 
     static std::string flagDescriptionName(const IFlag& flag, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << flagPrefix() << flag.info().name();
-        return stream.str();
+        return alignedRight(flagPrefix(), indent) + flag.info().name();
     }
 
     static std::string flagPrefix()
@@ -168,46 +156,29 @@ public:
 
     static std::string argUsageName(const IArg& arg)
     {
-        auto stream = std::stringstream{};
-        stream << "<" << arg.info().name() << ">";
-        return stream.str();
+        return "<" + arg.info().name() + ">";
     }
 
     static std::string argDescriptionName(const IArg& arg, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << arg.info().name() << "> (" << arg.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + arg.info().name() + "> (" + arg.info().valueName() + ")";
     }
 
     static std::string argListUsageName(const IArgList& argList)
     {
-        auto stream = std::stringstream{};
         if (argList.isOptional())
-            stream << "[" << argList.info().name() << "...]";
-        else
-            stream << "<" << argList.info().name() << "...>";
-        return stream.str();
+            return "[" + argList.info().name() + "...]";
+        return "<" + argList.info().name() + "...>";
     }
 
     static std::string argListDescriptionName(const IArgList& argList, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << argList.info().name() << "> (" << argList.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + argList.info().name() + "> (" + argList.info().valueName() + ")";
     }
 
     static std::string commandDescriptionName(const ICommand& command, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << command.info().name() << " [options]";
-        return stream.str();
+        return indentation(indent) + command.info().name() + " [options]";
     }
 };
 
@@ -0,0 +1,119 @@
+#ifndef CMDLIME_USAGEINFOCACHE_H
+#define CMDLIME_USAGEINFOCACHE_H
+
+#include "optioninfo.h"
+#include "options.h"
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace cmdlime::detail {
+
+//contains everything that the usage info is rendered from besides the output format and the program name.
+//Names, descriptions and default values are set by the config constructor and can change between the builds
+//of the same config type, so the options rebuilt for every read are compared by their source.
+class UsageInfoSource {
+public:
+    explicit UsageInfoSource(const Options& options)
+    {
+        for (const auto& param : options.params())
+            addOption(*param, param->isOptional(), param->defaultValue());
+        for (const auto& paramList : options.paramLists())
+            addOption(*paramList, paramList->isOptional(), paramList->defaultValue());
+        for (const auto& flag : options.flags())
+            addOption(*flag);
+        for (const auto& arg : options.args())
+            addOption(*arg);
+        if (const auto argList = options.argList())
+            addOption(*argList, argList->isOptional(), argList->defaultValue());
+        for (const auto& command : options.commands())
+            addOption(*command);
+    }
+
+    friend bool operator==(const UsageInfoSource& lhs, const UsageInfoSource& rhs)
+    {
+        return lhs.data_ == rhs.data_;
+    }
+
+    friend bool operator!=(const UsageInfoSource& lhs, const UsageInfoSource& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    void addOption(const IOption& option, bool isOptional = false, const std::string& defaultValue = {})
+    {
+        data_ += static_cast<char>(option.type());
+        data_ += static_cast<char>(isOptional);
+        addString(option.info().name());
+        addString(option.info().shortName());
+        addString(option.info().valueName());
+        addString(option.info().description());
+        addString(defaultValue);
+    }
+
+    //the strings are prefixed with their size, so the adjacent ones can't be confused
+    void addString(const std::string& str)
+    {
+        data_ += std::to_string(str.size());
+        data_ += ':';
+        data_ += str;
+    }
+
+private:
+    std::string data_;
+};
+
+//stores the usage info text rendered on the first request, it's rendered again when the source options change
+//and reset when the output format changes.
+//Usage info can be requested by errors of the compiled readers from multiple threads, so the access is synchronized.
+class UsageInfoCache {
+public:
+    UsageInfoCache() = default;
+
+    UsageInfoCache(const UsageInfoCache&)
+    {
+    }
+
+    UsageInfoCache& operator=(const UsageInfoCache&)
+    {
+        reset();
+        return *this;
+    }
+
+    //the returned reference stays valid until the cache is reset or the text is rendered from another source
+    template<typename TRenderFunc>
+    const std::string& get(const UsageInfoSource& source, const TRenderFunc& render) const
+    {
+        auto lock = std::lock_guard{mutex_};
+        if (!text_ || !source_ || *source_ != source) {
+            text_ = render();
+            source_ = source;
+            ++renderCount_;
+        }
+        return *text_;
+    }
+
+    std::size_t renderCount() const
+    {
+        auto lock = std::lock_guard{mutex_};
+        return renderCount_;
+    }
+
+    void reset()
+    {
+        auto lock = std::lock_guard{mutex_};
+        text_.reset();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    mutable std::optional<std::string> text_;
+    mutable std::optional<UsageInfoSource> source_;
+    mutable std::size_t renderCount_ = 0;
+};
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_USAGEINFOCACHE_H
@@ -10,55 +10,54 @@
 #include "iparamlist.h"
 #include "optioninfo.h"
 #include "options.h"
-#include "external/sfun/string_utils.h"
+#include "utils.h"
 #include <cmdlime/usageinfoformat.h>
 #include <algorithm>
-#include <iomanip>
+#include <cctype>
 #include <memory>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 namespace cmdlime::detail {
 
-inline std::string adjustedToLineBreak(std::string line, std::string& text)
+inline bool isSpace(char ch)
 {
-    if (!text.empty() && !isspace(text.front())) {
-        auto trimmedLine = sfun::trim_front(line);
-        if (std::find_if(
-                    trimmedLine.begin(),
-                    trimmedLine.end(),
-                    [](auto ch)
-                    {
-                        return std::isspace(ch);
-                    }) == trimmedLine.end())
-            return line;
-        while (!isspace(line.back())) {
-            text.insert(text.begin(), 1, line.back());
-            line.pop_back();
-        }
-    }
-    return line;
+    return std::isspace(static_cast<unsigned char>(ch));
 }
 
-inline std::string popLine(std::string& text, std::size_t width, bool firstLine = false)
+inline std::string_view trimmedFront(std::string_view str)
 {
-    auto newLinePos = text.find('\n');
-    if (newLinePos != std::string::npos && newLinePos <= width) {
-        auto line = text.substr(0, newLinePos);
-        text.erase(text.begin(), text.begin() + static_cast<int>(newLinePos + 1));
-        if (!firstLine)
-            line = sfun::trim_front(line);
-        return line;
+    const auto it = std::find_if_not(str.begin(), str.end(), isSpace);
+    return str.substr(static_cast<std::size_t>(it - str.begin()));
+}
+
+//removes the line that fits into the passed width from the front of the text,
+//a line breaking a word is moved back to its last whitespace, unless the line consists of a single word
+inline std::string_view popLine(std::string_view& text, std::size_t width, bool firstLine = false)
+{
+    const auto newLinePos = text.find('\n');
+    if (newLinePos != std::string_view::npos && newLinePos <= width) {
+        const auto line = text.substr(0, newLinePos);
+        text.remove_prefix(newLinePos + 1);
+        return firstLine ? line : trimmedFront(line);
     }
 
-    auto line = text.substr(0, width);
-    if (text.size() < width)
-        text.clear();
-    else
-        text.erase(text.begin(), text.begin() + static_cast<int>(width));
-    if (!firstLine)
-        line = sfun::trim_front(line);
-    return adjustedToLineBreak(line, text);
+    const auto lineSize = std::min(width, text.size());
+    const auto line = firstLine ? text.substr(0, lineSize) : trimmedFront(text.substr(0, lineSize));
+    text.remove_prefix(lineSize);
+    if (text.empty() || isSpace(text.front()))
+        return line;
+
+    const auto wordPos = line.size() - trimmedFront(line).size();
+    auto lineBreakPos = line.size();
+    while (lineBreakPos > wordPos && !isSpace(line[lineBreakPos - 1]))
+        --lineBreakPos;
+    if (lineBreakPos == wordPos)
+        return line;
+
+    text = std::string_view{line.data() + lineBreakPos, line.size() - lineBreakPos + text.size()};
+    return line.substr(0, lineBreakPos);
 }
 
 template<typename T>
@@ -122,21 +121,39 @@ public:
 
     std::string createDetailed()
     {
-        return minimizedUsageInfo() + argsInfo() + paramsInfo() + paramListsInfo() + optionsInfo() +
-                optionalParamListsInfo() + flagsInfo() + commandsInfo();
+        auto result = std::string{};
+        result.reserve(estimatedSize());
+        minimizedUsageInfo(result);
+        argsInfo(result);
+        paramsInfo(result);
+        paramListsInfo(result);
+        optionsInfo(result);
+        optionalParamListsInfo(result);
+        flagsInfo(result);
+        commandsInfo(result);
+        return result;
     }
 
     std::string create()
     {
-        return usageInfo();
+        auto result = std::string{};
+        usageInfo(result);
+        return result;
     }
 
 private:
     using OutputFormatter = typename FormatCfg<formatType>::outputFormatter;
 
-    std::string usageInfo()
+    std::size_t estimatedSize() const
     {
-        auto result = "Usage: " + commandName_ + " ";
+        const auto optionsCount = options_.params().size() + options_.paramLists().size() + options_.flags().size() +
+                options_.args().size() + options_.commands().size() + 1;
+        return (optionsCount + 8) * static_cast<std::size_t>(std::max(outputSettings_.terminalWidth, 0));
+    }
+
+    void usageInfo(std::string& result)
+    {
+        result += "Usage: " + commandName_ + " ";
         if (!options_.commands().empty())
             result += "[commands] ";
 
@@ -159,12 +176,11 @@ private:
             result += OutputFormatter::argListUsageName(*options_.argList());
 
         result += "\n";
-        return result;
     }
 
-    std::string minimizedUsageInfo()
+    void minimizedUsageInfo(std::string& result)
     {
-        auto result = "Usage: " + commandName_ + " ";
+        result += "Usage: " + commandName_ + " ";
 
         if (!options_.commands().empty())
             result += "[commands] ";
@@ -188,26 +204,21 @@ private:
             result += OutputFormatter::argListUsageName(*options_.argList());
 
         result += "\n";
-        return result;
     }
 
-    std::string paramsInfo()
+    void paramsInfo(std::string& result)
     {
         if (params_.empty())
-            return {};
-        auto result = std::string{"Parameters:\n"};
+            return;
+        result += "Parameters:\n";
         for (const IParam& param : params_) {
             const auto name = OutputFormatter::paramDescriptionName(param, outputSettings_.nameIndentation) + "\n";
-            result += makeConfigFieldInfo(name, getDescription(param));
+            makeConfigFieldInfo(result, name, getDescription(param));
         }
-        return result;
     }
 
-    std::string paramListsInfo()
+    void paramListsInfo(std::string& result)
     {
-        if (paramLists_.empty())
-            return {};
-        auto result = std::string{};
         for (const IParamList& paramList : paramLists_) {
             const auto name =
                     OutputFormatter::paramListDescriptionName(paramList, outputSettings_.nameIndentation) + "\n";
@@ -216,82 +227,79 @@ private:
                 description += "\n(multi-value)";
             else
                 description += "multi-value";
-            result += makeConfigFieldInfo(name, description);
+            makeConfigFieldInfo(result, name, description);
         }
-        return result;
     }
 
-    std::string optionsInfo()
+    void optionsInfo(std::string& result)
     {
-        if (optionalParams_.empty())
-            return {};
-        auto result = std::string{};
         for (const IParam& option : optionalParams_) {
+            const auto defaultValue = option.defaultValue();
             auto description = getDescription(option);
             if (!description.empty()) {
-                if (!option.defaultValue().empty())
-                    description += "\n(optional, default: " + option.defaultValue() + ")";
+                if (!defaultValue.empty())
+                    description += "\n(optional, default: " + defaultValue + ")";
                 else
                     description += "\n(optional)";
             }
             else {
-                if (!option.defaultValue().empty())
-                    description += "optional, default: " + option.defaultValue();
+                if (!defaultValue.empty())
+                    description += "optional, default: " + defaultValue;
                 else
                     description += "optional";
             }
-            result += makeConfigFieldInfo(
+            makeConfigFieldInfo(
+                    result,
                     OutputFormatter::paramDescriptionName(option, outputSettings_.nameIndentation) + "\n",
                     description);
         }
-        return result;
     }
 
-    std::string optionalParamListsInfo()
+    void optionalParamListsInfo(std::string& result)
     {
-        if (optionalParamLists_.empty())
-            return {};
-        auto result = std::string{};
         for (const IParamList& option : optionalParamLists_) {
+            const auto defaultValue = option.defaultValue();
             auto description = getDescription(option);
             if (!description.empty()) {
                 description += "\n(multi-value, ";
-                if (!option.defaultValue().empty())
-                    description += "optional, default: " + option.defaultValue() + ")";
+                if (!defaultValue.empty())
+                    description += "optional, default: " + defaultValue + ")";
                 else
                     description += "optional)";
             }
             else {
                 description += "multi-value, ";
-                if (!option.defaultValue().empty())
-                    description += "optional, default: " + option.defaultValue();
+                if (!defaultValue.empty())
+                    description += "optional, default: " + defaultValue;
                 else
                     description += "optional";
             }
-            result += makeConfigFieldInfo(
+            makeConfigFieldInfo(
+                    result,
                     OutputFormatter::paramListDescriptionName(option, outputSettings_.nameIndentation) + "\n",
                     description);
         }
-        return result;
     }
 
-    std::string argsInfo()
+    void argsInfo(std::string& result)
     {
         if (options_.args().empty() && !options_.argList())
-            return {};
-        auto result = std::string{"Arguments:\n"};
+            return;
+        result += "Arguments:\n";
         for (const auto& arg : options_.args())
-            result += makeConfigFieldInfo(
+            makeConfigFieldInfo(
+                    result,
                     OutputFormatter::argDescriptionName(*arg, outputSettings_.nameIndentation) + "\n",
                     getDescription(*arg));
 
-        if (options_.argList()) {
-            auto description = getDescription(*options_.argList());
+        if (auto argList = options_.argList()) {
+            const auto defaultValue = argList->isOptional() ? argList->defaultValue() : std::string{};
+            auto description = getDescription(*argList);
             if (!description.empty()) {
                 description += "\n(multi-value";
-                if (options_.argList()->isOptional()) {
-                    if (!options_.argList()->defaultValue().empty())
-                        description += ", optional, default: " + options_.argList()->defaultValue() + ")";
+                if (argList->isOptional()) {
+                    if (!defaultValue.empty())
+                        description += ", optional, default: " + defaultValue + ")";
                     else
                         description += ", optional)";
                 }
@@ -300,53 +308,50 @@ private:
             }
             else {
                 description += "multi-value";
-                if (options_.argList()->isOptional()) {
-                    if (!options_.argList()->defaultValue().empty())
-                        description += ", optional, default: " + options_.argList()->defaultValue();
+                if (argList->isOptional()) {
+                    if (!defaultValue.empty())
+                        description += ", optional, default: " + defaultValue;
                     else
                         description += ", optional";
                 }
             }
-            result += makeConfigFieldInfo(
-                    OutputFormatter::argListDescriptionName(*options_.argList(), outputSettings_.nameIndentation) +
-                            "\n",
+            makeConfigFieldInfo(
+                    result,
+                    OutputFormatter::argListDescriptionName(*argList, outputSettings_.nameIndentation) + "\n",
                     description);
         }
-        return result;
     }
 
-    std::string flagsInfo()
+    void flagsInfo(std::string& result)
     {
         if (options_.flags().empty())
-            return {};
-        auto result = std::string{"Flags:\n"};
+            return;
+        result += "Flags:\n";
         for (const auto& flag : options_.flags())
-            result += makeConfigFieldInfo(
+            makeConfigFieldInfo(
+                    result,
                     OutputFormatter::flagDescriptionName(*flag, outputSettings_.nameIndentation) + "\n",
                     getDescription(*flag));
-        return result;
     }
 
-    std::string commandsInfo()
+    void commandsInfo(std::string& result)
     {
         if (options_.commands().empty())
-            return {};
-        auto result = std::string{"Commands:\n"};
-        for (const auto& command : options_.commands()) {
-            auto nameStream = std::stringstream{};
-            if (outputSettings_.nameIndentation)
-                nameStream << std::setw(outputSettings_.nameIndentation) << " ";
-            nameStream << getName(*command) << " [options]";
-            result += makeConfigFieldInfo(nameStream.str(), getDescription(*command));
-        }
-        return result;
+            return;
+        result += "Commands:\n";
+        for (const auto& command : options_.commands())
+            makeConfigFieldInfo(
+                    result,
+                    indentation(outputSettings_.nameIndentation) + getName(*command) + " [options]",
+                    getDescription(*command));
     }
 
     int maxOptionNameLength()
     {
         auto length = 0;
-        auto updateLength = [&length](std::string name)
+        auto updateLength = [&length](const std::string& nameText)
         {
+            auto name = std::string_view{nameText};
             auto firstLine = true;
             do {
                 auto nameLine = popLine(name, 100, firstLine);
@@ -371,30 +376,34 @@ private:
         return length;
     }
 
-    std::string makeConfigFieldInfo(std::string name, std::string description)
+    void makeConfigFieldInfo(std::string& result, const std::string& nameText, const std::string& descriptionText)
     {
+        auto name = std::string_view{nameText};
+        auto description = std::string_view{descriptionText};
         auto maxNameWidth = std::min(outputSettings_.maxNameColumnWidth, maxOptionNameSize_);
         const auto columnSeparatorWidth = 1;
         const auto leftColumnWidth = columnSeparatorWidth + maxNameWidth;
         const auto rightColumnWidth = static_cast<std::size_t>(outputSettings_.terminalWidth - leftColumnWidth);
         const auto descriptionWidth = rightColumnWidth - 2;
-        auto stream = std::stringstream{};
         auto firstLine = true;
         while (!name.empty()) {
-            auto nameLine = popLine(name, static_cast<std::size_t>(maxNameWidth), firstLine);
+            const auto nameLine = popLine(name, static_cast<std::size_t>(maxNameWidth), firstLine);
             const auto descriptionLine = popLine(description, descriptionWidth, firstLine);
-            if (firstLine)
-                stream << std::setw(maxNameWidth) << std::left << nameLine << " " << descriptionLine << std::endl;
-            else
-                stream << std::setw(maxNameWidth) << std::left << nameLine << "   " << descriptionLine << std::endl;
+            result += nameLine;
+            if (maxNameWidth > static_cast<int>(nameLine.size()))
+                result.append(static_cast<std::size_t>(maxNameWidth) - nameLine.size(), ' ');
+            result += firstLine ? " " : "   ";
+            result += descriptionLine;
+            result += "\n";
             firstLine = false;
         }
         while (!description.empty()) {
-            auto descriptionLine = popLine(description, descriptionWidth);
-            stream << std::setw(leftColumnWidth) << " "
-                   << "  " << descriptionLine << std::endl;
+            const auto descriptionLine = popLine(description, descriptionWidth);
+            result += indentation(leftColumnWidth);
+            result += "  ";
+            result += descriptionLine;
+            result += "\n";
         }
-        return stream.str();
     }
 
 private:
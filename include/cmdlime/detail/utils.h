@@ -1,13 +1,22 @@
 #ifndef CMDLIME_UTILS_H
 #define CMDLIME_UTILS_H
 
+#include "charconv.h"
 #include "initializedoptional.h"
 #include "nameof_import.h"
 #include "external/sfun/type_traits.h"
+#include <cmdlime/arglistsink.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace cmdlime::detail {
 
@@ -20,15 +29,67 @@ inline std::string capitalize(const std::string& input)
     return result;
 }
 
-inline bool isNumber(const std::string& str)
+//pads the string with leading spaces to the passed width, like std::setw() does when the string is written to a stream
+inline std::string alignedRight(std::string_view str, int width)
 {
-    auto check = [&str](auto num)
+    auto result = std::string{};
+    if (width > static_cast<int>(str.size()))
+        result.append(static_cast<std::size_t>(width) - str.size(), ' ');
+    result += str;
+    return result;
+}
+
+inline std::string indentation(int width)
+{
+    return std::string(static_cast<std::size_t>(std::max(width, 0)), ' ');
+}
+
+inline std::string_view trimmed(std::string_view str)
+{
+    const auto isSpace = [](char ch)
     {
-        std::stringstream stream{str};
-        stream >> num;
-        return !stream.bad() && !stream.fail() && stream.eof();
+        return std::isspace(static_cast<unsigned char>(ch)) != 0;
     };
-    return check(int64_t{}) || check(double{});
+    const auto begin = std::find_if_not(str.begin(), str.end(), isSpace);
+    const auto end = std::find_if_not(str.rbegin(), str.rend(), isSpace).base();
+    if (begin >= end)
+        return {};
+    return str.substr(static_cast<std::size_t>(begin - str.begin()), static_cast<std::size_t>(end - begin));
+}
+
+template<typename T, typename = void>
+struct isReservable : std::false_type {};
+
+template<typename T>
+struct isReservable<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{}))>> : std::true_type {};
+
+//strings of chars with any allocator, like std::pmr::string
+template<typename T>
+struct isCharString : std::false_type {};
+
+template<typename TTraits, typename TAllocator>
+struct isCharString<std::basic_string<char, TTraits, TAllocator>> : std::true_type {};
+
+template<typename T>
+struct isStdArray : std::false_type {};
+
+template<typename T, std::size_t N>
+struct isStdArray<std::array<T, N>> : std::true_type {};
+
+inline bool isNumber(std::string_view str)
+{
+    auto intValue = int64_t{};
+    if (fromChars(str, intValue) == std::errc{})
+        return true;
+#ifdef __cpp_lib_to_chars
+    auto doubleValue = double{};
+    return fromChars(str, doubleValue) == std::errc{};
+#else
+    auto stream = std::stringstream{std::string{str}};
+    auto doubleValue = double{};
+    stream >> doubleValue;
+    return !stream.bad() && !stream.fail() && stream.eof();
+#endif
 }
 
 #ifdef CMDLIME_NAMEOF_AVAILABLE
@@ -38,13 +99,17 @@ inline std::string nameOfType()
     using type = std::remove_const_t<std::remove_reference_t<TCfg>>;
     auto result = [&]
     {
-        if constexpr (sfun::is_optional_v<type> || sfun::is_dynamic_sequence_container_v<type>)
+        if constexpr (
+                sfun::is_optional_v<type> || sfun::is_dynamic_sequence_container_v<type> || isStdArray<type>::value ||
+                isArgListSink<type>::value)
             return std::string{nameof::nameof_short_type<typename type::value_type>()};
         else
             return std::string{nameof::nameof_short_type<type>()};
     }();
     if (result == "basic_string")
         result = "string";
+    else if (result == "basic_string_view")
+        result = "string_view";
 
     return result;
 }
@@ -1,13 +1,16 @@
 #ifndef CMDLIME_VALIDATOR_H
 #define CMDLIME_VALIDATOR_H
 
+#include "configfield.h"
 #include "ioption.h"
 #include "ivalidator.h"
 #include "optioninfo.h"
 #include "utils.h"
 #include "external/sfun/utility.h"
 #include <cmdlime/errors.h>
+#include <cmdlime/readresult.h>
 #include <functional>
+#include <optional>
 
 namespace cmdlime::detail {
 
@@ -37,33 +40,38 @@ inline std::string validatorOptionTypeName(OptionType optionType)
 template<typename T>
 class Validator : public IValidator {
 public:
-    Validator(IOption& option, T& optionValue, std::function<void(const T&)> validatingFunc)
+    Validator(IOption& option, ConfigField<T> optionField, std::function<void(const T&)> validatingFunc)
         : option_(option)
-        , optionValue_(optionValue)
+        , optionField_(optionField)
         , validatingFunc_(std::move(validatingFunc))
     {
     }
 
 private:
-    void validate(const std::string& commandName) const override
+    std::optional<ReadError> validate(Config& cfg, const std::string& commandName) const override
     {
-        auto makeErrorMessage = [&](const auto& message)
+        auto makeError = [&](const std::string& message)
         {
-            auto prefix = commandName.empty()
-                    ? capitalize(validatorOptionTypeName(option_.type()))
-                    : "Command '" + commandName + "'s " + validatorOptionTypeName(option_.type());
-            return prefix + " '" + option_.info().name() + "' is invalid: " + message;
+            auto error = ReadError{
+                    ReadErrorType::InvalidOption,
+                    {},
+                    option_.info().name(),
+                    validatorOptionTypeName(option_.type()),
+                    message};
+            ReadErrorAccess::setCommandName(error, commandName);
+            return error;
         };
 
         try {
-            validatingFunc_(optionValue_);
+            validatingFunc_(optionField_(cfg));
         }
         catch (const ValidationError& e) {
-            throw ParsingError{makeErrorMessage(e.what())};
+            return makeError(e.what());
         }
         catch (...) {
-            throw ParsingError{makeErrorMessage("Unexpected error")};
+            return makeError("Unexpected error");
         }
+        return std::nullopt;
     }
 
     OptionType optionType() const override
@@ -72,7 +80,7 @@ private:
     }
 
     IOption& option_;
-    T& optionValue_;
+    ConfigField<T> optionField_;
     std::function<void(const T&)> validatingFunc_;
 };
 
@@ -10,8 +10,6 @@
 #include <cmdlime/errors.h>
 #include <algorithm>
 #include <functional>
-#include <iomanip>
-#include <sstream>
 
 namespace cmdlime::detail {
 
@@ -19,52 +17,8 @@ template<Format formatType>
 class X11Parser : public Parser<formatType> {
     using Parser<formatType>::Parser;
 
-    void preProcess() override
-    {
-        checkNames();
-        foundParam_.clear();
-    }
-
-    void process(const std::string& token) override
-    {
-        if (!foundParam_.empty()) {
-            this->readParam(foundParam_, token);
-            foundParam_.clear();
-        }
-        else if (sfun::starts_with(token, "-") && token.size() > 1) {
-            auto command = sfun::after(token, "-").value();
-            if (isParamOrFlag(command) && !foundParam_.empty())
-                throw ParsingError{"Parameter '-" + foundParam_ + "' value can't be empty"};
-
-            if (auto param = this->findParam(command))
-                foundParam_ = param->info().name();
-            else if (auto paramList = this->findParamList(command))
-                foundParam_ = paramList->info().name();
-            else if (this->findFlag(command))
-                this->readFlag(command);
-            else if (isNumber(token))
-                this->readArg(token);
-            else
-                throw ParsingError{"Encountered unknown parameter or flag '" + token + "'"};
-        }
-        else
-            this->readArg(token);
-    }
-
-    void postProcess() override
-    {
-        if (!foundParam_.empty())
-            throw ParsingError{"Parameter '-" + foundParam_ + "' value can't be empty"};
-    }
-
-    bool isParamOrFlag(std::string_view cmd)
-    {
-        if (cmd.empty())
-            return false;
-        return this->findFlag(cmd) || this->findParam(cmd) || this->findParamList(cmd);
-    }
-
-    void checkNames()
+public:
+    static void checkNames(const Options& options)
     {
         auto check = [](const OptionInfo& var, const std::string& varType)
         {
@@ -84,23 +38,68 @@ class X11Parser : public Parser<formatType> {
                             "' must consist of alphanumeric characters and hyphens"};
             }
         };
-        this->forEachParamInfo(
+        Parser<formatType>::forEachParamInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachParamListInfo(
+        Parser<formatType>::forEachParamListInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Parameter");
                 });
-        this->forEachFlagInfo(
+        Parser<formatType>::forEachFlagInfo(
+                options,
                 [check](const OptionInfo& var)
                 {
                     check(var, "Flag");
                 });
     }
 
+private:
+    void preProcess() override
+    {
+        foundParam_.clear();
+    }
+
+    void process(std::string_view token) override
+    {
+        if (!foundParam_.empty()) {
+            this->readParam(foundParam_, token);
+            foundParam_.clear();
+        }
+        else if (sfun::starts_with(token, "-") && token.size() > 1) {
+            auto command = sfun::after(token, "-").value();
+            const auto option = this->findOption(command);
+            if (option && !foundParam_.empty()) {
+                this->fail({ReadErrorType::EmptyParamValue, "-", foundParam_});
+                return;
+            }
+
+            if (auto param = option.param())
+                foundParam_ = param->info().name();
+            else if (auto paramList = option.paramList())
+                foundParam_ = paramList->info().name();
+            else if (option.flag())
+                this->readFlag(command);
+            else if (isNumber(token))
+                this->readArg(token);
+            else
+                this->fail({ReadErrorType::UnknownParamOrFlag, "-", std::string{command}});
+        }
+        else
+            this->readArg(token);
+    }
+
+    void postProcess() override
+    {
+        if (!foundParam_.empty())
+            this->addError({ReadErrorType::EmptyParamValue, "-", foundParam_});
+    }
+
+
 private:
     std::string foundParam_;
 };
@@ -132,36 +131,28 @@ class X11OutputFormatter {
 public:
     static std::string paramUsageName(const IParam& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + " <" + param.info().valueName() + ">";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">]";
-        else
-            stream << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramListUsageName(const IParamList& param)
     {
-        auto stream = std::stringstream{};
+        const auto usageName = paramPrefix() + param.info().name() + " <" + param.info().valueName() + ">...";
         if (param.isOptional())
-            stream << "[" << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">...]";
-        else
-            stream << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">...";
-        return stream.str();
+            return "[" + usageName + "]";
+        return usageName;
     }
 
     static std::string paramDescriptionName(const IParam& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+        return alignedRight(paramPrefix(), indent) + param.info().name() + " <" + param.info().valueName() + ">";
     }
 
     static std::string paramListDescriptionName(const IParamList& param, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << paramPrefix() << param.info().name() << " <" << param.info().valueName() << ">";
-        return stream.str();
+        return alignedRight(paramPrefix(), indent) + param.info().name() + " <" + param.info().valueName() + ">";
     }
 
     static std::string paramPrefix()
@@ -171,16 +162,12 @@ public:
 
     static std::string flagUsageName(const IFlag& flag)
     {
-        auto stream = std::stringstream{};
-        stream << "[" << flagPrefix() << flag.info().name() << "]";
-        return stream.str();
+        return "[" + flagPrefix() + flag.info().name() + "]";
     }
 
     static std::string flagDescriptionName(const IFlag& flag, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        stream << std::setw(indent) << flagPrefix() << flag.info().name();
-        return stream.str();
+        return alignedRight(flagPrefix(), indent) + flag.info().name();
     }
 
     static std::string flagPrefix()
@@ -190,46 +177,29 @@ public:
 
     static std::string argUsageName(const IArg& arg)
     {
-        auto stream = std::stringstream{};
-        stream << "<" << arg.info().name() << ">";
-        return stream.str();
+        return "<" + arg.info().name() + ">";
     }
 
     static std::string argDescriptionName(const IArg& arg, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << arg.info().name() << "> (" << arg.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + arg.info().name() + "> (" + arg.info().valueName() + ")";
     }
 
     static std::string argListUsageName(const IArgList& argList)
     {
-        auto stream = std::stringstream{};
         if (argList.isOptional())
-            stream << "[" << argList.info().name() << "...]";
-        else
-            stream << "<" << argList.info().name() << "...>";
-        return stream.str();
+            return "[" + argList.info().name() + "...]";
+        return "<" + argList.info().name() + "...>";
     }
 
     static std::string argListDescriptionName(const IArgList& argList, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << "<" << argList.info().name() << "> (" << argList.info().valueName() << ")";
-        return stream.str();
+        return indentation(indent) + "<" + argList.info().name() + "> (" + argList.info().valueName() + ")";
     }
 
     static std::string commandDescriptionName(const ICommand& command, int indent = 0)
     {
-        auto stream = std::stringstream{};
-        if (indent)
-            stream << std::setw(indent) << " ";
-        stream << command.info().name() << " [options]";
-        return stream.str();
+        return indentation(indent) + command.info().name() + " [options]";
     }
 };
 
@@ -1,7 +1,10 @@
 #ifndef CMDLIME_ERRORS_H
 #define CMDLIME_ERRORS_H
 
+#include <functional>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 namespace cmdlime {
@@ -44,6 +47,17 @@ public:
     {
     }
 
+    //the usage info is rendered by the passed function on the first commandUsageInfo() call
+    CommandError(
+            std::string commandName,
+            std::function<std::string()> commandUsageInfoRenderer,
+            const std::string& errorMsg)
+        : Error(errorMsg)
+        , commandName_(std::move(commandName))
+        , commandUsageInfoRenderer_(std::move(commandUsageInfoRenderer))
+    {
+    }
+
     const std::string& commandName() const
     {
         return commandName_;
@@ -51,12 +65,15 @@ public:
 
     const std::string& commandUsageInfo() const
     {
-        return commandUsageInfo_;
+        if (!commandUsageInfo_)
+            commandUsageInfo_ = commandUsageInfoRenderer_ ? commandUsageInfoRenderer_() : std::string{};
+        return *commandUsageInfo_;
     }
 
 private:
     std::string commandName_;
-    std::string commandUsageInfo_;
+    std::function<std::string()> commandUsageInfoRenderer_;
+    mutable std::optional<std::string> commandUsageInfo_;
 };
 
 class CommandParsingError : public CommandError {
@@ -65,6 +82,14 @@ public:
         : CommandError(std::move(commandName), std::move(commandUsageInfo), error.what())
     {
     }
+
+    CommandParsingError(
+            std::string commandName,
+            std::function<std::string()> commandUsageInfoRenderer,
+            const ParsingError& error)
+        : CommandError(std::move(commandName), std::move(commandUsageInfoRenderer), error.what())
+    {
+    }
 };
 
 class CommandConfigError : public CommandError {
@@ -73,6 +98,14 @@ public:
         : CommandError(std::move(commandName), std::move(commandUsageInfo), error.what())
     {
     }
+
+    CommandConfigError(
+            std::string commandName,
+            std::function<std::string()> commandUsageInfoRenderer,
+            const ConfigError& error)
+        : CommandError(std::move(commandName), std::move(commandUsageInfoRenderer), error.what())
+    {
+    }
 };
 
 } //namespace cmdlime
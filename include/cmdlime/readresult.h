@@ -0,0 +1,315 @@
+#ifndef CMDLIME_READRESULT_H
+#define CMDLIME_READRESULT_H
+
+#include <cctype>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace cmdlime::detail {
+class ReadErrorAccess;
+
+enum class ReadErrorType {
+    ConfigError,
+    EmptyParamValue,
+    EmptyArgValue,
+    EmptyArgListValue,
+    UnknownParam,
+    UnknownFlag,
+    UnknownParamOrFlag,
+    UnknownShortOption,
+    UnknownArg,
+    InvalidParamValue,
+    InvalidArgValue,
+    InvalidArgListValue,
+    MissingParam,
+    MissingArg,
+    MissingArgList,
+    OptionsAfterArgs,
+    EmptyOptionName,
+    WrongParamFormat,
+    WrongParamListSize,
+    InvalidOption,
+    InvalidCommandLine
+};
+
+} //namespace cmdlime::detail
+
+namespace cmdlime {
+
+enum class ReadErrorMode {
+    StopOnFirstError,
+    CollectAllErrors
+};
+
+enum class ReadErrorKind {
+    ConfigError,
+    UnknownOption,
+    UnexpectedArgument,
+    EmptyValue,
+    InvalidValue,
+    MissingOption,
+    InvalidFormat,
+    ValidationError
+};
+
+//error of the command line reading, it stores the details of the error and creates the message only when it's requested
+class ReadError {
+    friend class detail::ReadErrorAccess;
+    using Type = detail::ReadErrorType;
+
+public:
+    ReadError(
+            detail::ReadErrorType type,
+            std::string optionPrefix = {},
+            std::string optionName = {},
+            std::string value = {},
+            std::string details = {})
+        : type_{type}
+        , optionPrefix_{std::move(optionPrefix)}
+        , optionName_{std::move(optionName)}
+        , value_{std::move(value)}
+        , details_{std::move(details)}
+    {
+    }
+
+    ReadErrorKind kind() const
+    {
+        switch (type_) {
+        case Type::ConfigError:
+            return ReadErrorKind::ConfigError;
+        case Type::EmptyParamValue:
+        case Type::EmptyArgValue:
+        case Type::EmptyArgListValue:
+            return ReadErrorKind::EmptyValue;
+        case Type::UnknownParam:
+        case Type::UnknownFlag:
+        case Type::UnknownParamOrFlag:
+        case Type::UnknownShortOption:
+            return ReadErrorKind::UnknownOption;
+        case Type::UnknownArg:
+            return ReadErrorKind::UnexpectedArgument;
+        case Type::InvalidParamValue:
+        case Type::InvalidArgValue:
+        case Type::InvalidArgListValue:
+        case Type::WrongParamListSize:
+            return ReadErrorKind::InvalidValue;
+        case Type::MissingParam:
+        case Type::MissingArg:
+        case Type::MissingArgList:
+            return ReadErrorKind::MissingOption;
+        case Type::OptionsAfterArgs:
+        case Type::EmptyOptionName:
+        case Type::WrongParamFormat:
+            return ReadErrorKind::InvalidFormat;
+        case Type::InvalidOption:
+        case Type::InvalidCommandLine:
+            return ReadErrorKind::ValidationError;
+        }
+        return ReadErrorKind::ConfigError;
+    }
+
+    //index of the command line token where the error was found, the program name isn't counted
+    std::optional<std::size_t> tokenIndex() const
+    {
+        return tokenIndex_;
+    }
+
+    const std::string& optionName() const
+    {
+        return optionName_;
+    }
+
+    //name of the command that contains the error, it's empty for the errors of the main config
+    const std::string& commandName() const
+    {
+        return commandName_;
+    }
+
+    std::string message() const
+    {
+        const auto details = details_.empty() ? std::string{} : ": " + details_;
+        const auto option = "'" + optionPrefix_ + optionName_ + "'";
+        switch (type_) {
+        case Type::ConfigError:
+            return details_;
+        case Type::EmptyParamValue:
+            return "Parameter " + option + " value can't be empty";
+        case Type::EmptyArgValue:
+            return "Argument " + option + " value can't be empty";
+        case Type::EmptyArgListValue:
+            return "Argument list " + option + " element value can't be empty";
+        case Type::UnknownParam:
+            return "Encountered unknown parameter " + option;
+        case Type::UnknownFlag:
+            return "Encountered unknown flag " + option;
+        case Type::UnknownParamOrFlag:
+            return "Encountered unknown parameter or flag " + option;
+        case Type::UnknownShortOption:
+            return "Unknown option '" + optionName_ + "' in command '" + optionPrefix_ + value_ + "'";
+        case Type::UnknownArg:
+            return "Encountered unknown positional argument '" + value_ + "'";
+        case Type::InvalidParamValue:
+            return "Couldn't set parameter " + option + " value from '" + value_ + "'" + details;
+        case Type::InvalidArgValue:
+            return "Couldn't set argument " + option + " value from '" + value_ + "'" + details;
+        case Type::InvalidArgListValue:
+            return "Couldn't set argument list " + option + " element's value from '" + value_ + "'" + details;
+        case Type::MissingParam:
+            return "Parameter " + option + " is missing.";
+        case Type::MissingArg:
+            return "Positional argument " + option + " is missing.";
+        case Type::MissingArgList:
+            return "Arguments list " + option + " is missing.";
+        case Type::OptionsAfterArgs:
+            return "Flags and parameters must precede arguments";
+        case Type::EmptyOptionName:
+            return "Flags and parameters must have a name";
+        case Type::WrongParamFormat:
+            return "Wrong parameter format: " + value_ + ". Parameter must have a form of -name=value";
+        case Type::WrongParamListSize:
+            return "Parameter " + option + " must have exactly " + value_ + " values";
+        case Type::InvalidOption: {
+            auto optionType = value_;
+            if (commandName_.empty() && !optionType.empty())
+                optionType[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(optionType[0])));
+            const auto prefix = commandName_.empty() ? optionType : "Command '" + commandName_ + "'s " + optionType;
+            return prefix + " " + option + " is invalid: " + details_;
+        }
+        case Type::InvalidCommandLine:
+            return "Command line is invalid: " + details_;
+        }
+        return details_;
+    }
+
+private:
+    detail::ReadErrorType type_;
+    std::string optionPrefix_;
+    std::string optionName_;
+    std::string value_;
+    std::string details_;
+    std::string commandName_;
+    std::optional<std::size_t> tokenIndex_;
+    //renders the usage info of the command containing the error, it owns the command's reader,
+    //so errors can outlive the command line reader
+    std::function<std::string()> commandUsageInfoRenderer_;
+};
+
+//result of CommandLineReader::tryRead(), it contains either the read config or the errors
+template<typename TCfg>
+class ReadResult {
+public:
+    ReadResult(TCfg cfg)
+        : result_{std::in_place_index<0>, std::move(cfg)}
+    {
+    }
+
+    ReadResult(std::vector<ReadError> errors)
+        : result_{std::in_place_index<1>, std::move(errors)}
+    {
+    }
+
+    bool has_value() const
+    {
+        return result_.index() == 0;
+    }
+
+    explicit operator bool() const
+    {
+        return has_value();
+    }
+
+    TCfg& value()
+    {
+        return std::get<0>(result_);
+    }
+
+    const TCfg& value() const
+    {
+        return std::get<0>(result_);
+    }
+
+    TCfg& operator*()
+    {
+        return value();
+    }
+
+    const TCfg& operator*() const
+    {
+        return value();
+    }
+
+    TCfg* operator->()
+    {
+        return &value();
+    }
+
+    const TCfg* operator->() const
+    {
+        return &value();
+    }
+
+    const ReadError& error() const
+    {
+        return errors().front();
+    }
+
+    //contains only the first error, unless the reader's error mode is ReadErrorMode::CollectAllErrors
+    const std::vector<ReadError>& errors() const
+    {
+        return std::get<1>(result_);
+    }
+
+private:
+    std::variant<TCfg, std::vector<ReadError>> result_;
+};
+
+} //namespace cmdlime
+
+namespace cmdlime::detail {
+
+class ReadErrorAccess {
+public:
+    static void setTokenIndex(ReadError& error, std::optional<std::size_t> tokenIndex)
+    {
+        error.tokenIndex_ = tokenIndex;
+    }
+
+    static void setCommandName(ReadError& error, const std::string& commandName)
+    {
+        error.commandName_ = commandName;
+    }
+
+    //sets the innermost command containing the error, token indices of nested commands are shifted
+    //by the position of the command line part that the command has read
+    static void setCommand(
+            ReadError& error,
+            const std::function<std::string()>& commandUsageInfoRenderer,
+            const std::string& commandName,
+            std::size_t tokenOffset)
+    {
+        if (!error.commandUsageInfoRenderer_) {
+            error.commandUsageInfoRenderer_ = commandUsageInfoRenderer;
+            error.commandName_ = commandName;
+        }
+        if (error.tokenIndex_)
+            *error.tokenIndex_ += tokenOffset;
+    }
+
+    //returns the usage info renderer of the command which usage info is shown with the error,
+    //it's empty when the error isn't related to a command; validation errors are reported without it
+    static std::function<std::string()> commandUsageInfoRenderer(const ReadError& error)
+    {
+        if (error.kind() == ReadErrorKind::ValidationError)
+            return {};
+        return error.commandUsageInfoRenderer_;
+    }
+};
+
+} //namespace cmdlime::detail
+
+#endif //CMDLIME_READRESULT_H
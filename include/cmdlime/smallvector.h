@@ -0,0 +1,251 @@
+#ifndef CMDLIME_SMALLVECTOR_H
+#define CMDLIME_SMALLVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cmdlime {
+
+//sequence container storing up to N elements inside the object, the elements are moved to a heap allocated buffer
+//when more of them are added
+template<typename T, std::size_t N>
+class SmallVector {
+    static_assert(N > 0, "SmallVector must be able to store at least one element inside the object");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr std::size_t inlineCapacity = N;
+
+    SmallVector() = default;
+
+    SmallVector(std::initializer_list<T> elements)
+    {
+        for (const auto& element : elements)
+            emplace_back(element);
+    }
+
+    SmallVector(const SmallVector& other)
+    {
+        for (const auto& element : other)
+            emplace_back(element);
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        moveFrom(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this == &other)
+            return *this;
+        clear();
+        for (const auto& element : other)
+            emplace_back(element);
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this == &other)
+            return *this;
+        clear();
+        moveFrom(other);
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        destroyInlineElements();
+    }
+
+    template<typename... TArgs>
+    T& emplace_back(TArgs&&... args)
+    {
+        if (isOnHeap_)
+            return heap_.emplace_back(std::forward<TArgs>(args)...);
+
+        if (inlineSize_ < N) {
+            auto element = ::new (static_cast<void*>(inlineData() + inlineSize_)) T(std::forward<TArgs>(args)...);
+            ++inlineSize_;
+            return *element;
+        }
+
+        //the arguments can reference the inline elements, so the new element is created before they're moved
+        auto element = T(std::forward<TArgs>(args)...);
+        moveToHeap(std::move(element));
+        return heap_.back();
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void clear()
+    {
+        destroyInlineElements();
+        heap_ = std::vector<T>{};
+        isOnHeap_ = false;
+    }
+
+    std::size_t size() const
+    {
+        return isOnHeap_ ? heap_.size() : inlineSize_;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    //returns true if the elements don't fit into the object and are stored on the heap
+    bool isOnHeap() const
+    {
+        return isOnHeap_;
+    }
+
+    T* data()
+    {
+        return isOnHeap_ ? heap_.data() : inlineData();
+    }
+
+    const T* data() const
+    {
+        return isOnHeap_ ? heap_.data() : inlineData();
+    }
+
+    T& operator[](std::size_t index)
+    {
+        return data()[index];
+    }
+
+    const T& operator[](std::size_t index) const
+    {
+        return data()[index];
+    }
+
+    T& front()
+    {
+        return *begin();
+    }
+
+    const T& front() const
+    {
+        return *begin();
+    }
+
+    T& back()
+    {
+        return *(end() - 1);
+    }
+
+    const T& back() const
+    {
+        return *(end() - 1);
+    }
+
+    iterator begin()
+    {
+        return data();
+    }
+
+    iterator end()
+    {
+        return data() + size();
+    }
+
+    const_iterator begin() const
+    {
+        return data();
+    }
+
+    const_iterator end() const
+    {
+        return data() + size();
+    }
+
+    friend bool operator==(const SmallVector& lhs, const SmallVector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator!=(const SmallVector& lhs, const SmallVector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    T* inlineData()
+    {
+        return std::launder(reinterpret_cast<T*>(inlineStorage_));
+    }
+
+    const T* inlineData() const
+    {
+        return std::launder(reinterpret_cast<const T*>(inlineStorage_));
+    }
+
+    void destroyInlineElements()
+    {
+        std::destroy_n(inlineData(), inlineSize_);
+        inlineSize_ = 0;
+    }
+
+    //the elements stay inline if the heap buffer can't be filled
+    void moveToHeap(T&& element)
+    {
+        auto heap = std::vector<T>{};
+        heap.reserve(N * 2);
+        for (auto& inlineElement : *this)
+            heap.push_back(std::move_if_noexcept(inlineElement));
+        heap.push_back(std::move(element));
+
+        destroyInlineElements();
+        heap_ = std::move(heap);
+        isOnHeap_ = true;
+    }
+
+    void moveFrom(SmallVector& other)
+    {
+        if (other.isOnHeap_) {
+            heap_ = std::move(other.heap_);
+            isOnHeap_ = true;
+            other.clear();
+            return;
+        }
+        for (auto& element : other)
+            emplace_back(std::move(element));
+        other.clear();
+    }
+
+private:
+    alignas(T) std::byte inlineStorage_[sizeof(T) * N];
+    std::size_t inlineSize_ = 0;
+    std::vector<T> heap_;
+    bool isOnHeap_ = false;
+};
+
+} //namespace cmdlime
+
+#endif //CMDLIME_SMALLVECTOR_H
@@ -2,11 +2,15 @@
 #define CMDLIME_STRINGCONVERTER_H
 
 #include "errors.h"
+#include "detail/charconv.h"
 #include "detail/external/sfun/type_traits.h"
 #include "detail/utils.h"
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace cmdlime {
@@ -18,10 +22,16 @@ struct StringConverter {
         if constexpr (sfun::is_optional_v<T>) {
             if (!value)
                 return {};
-            auto stream = std::stringstream{};
-            stream << *value;
-            return stream.str();
+            if constexpr (detail::isCharConvertible_v<typename T::value_type>)
+                return detail::toChars(*value);
+            else {
+                auto stream = std::stringstream{};
+                stream << *value;
+                return stream.str();
+            }
         }
+        else if constexpr (detail::isCharConvertible_v<T>)
+            return detail::toChars(value);
         else {
             auto stream = std::stringstream{};
             stream << value;
@@ -29,11 +39,11 @@ struct StringConverter {
         }
     }
 
-    static std::optional<T> fromString(const std::string& data)
+    static std::optional<T> fromString(std::string_view data)
     {
-        [[maybe_unused]] auto setValue = [](auto& value, const std::string& data) -> std::optional<T>
+        [[maybe_unused]] auto setValue = [](auto& value, std::string_view data) -> std::optional<T>
         {
-            auto stream = std::stringstream{data};
+            auto stream = std::stringstream{std::string{data}};
             stream >> value;
 
             if (stream.bad() || stream.fail() || !stream.eof())
@@ -41,9 +51,25 @@ struct StringConverter {
             return value;
         };
 
-        if constexpr (std::is_convertible_v<sfun::remove_optional_t<T>, std::string>) {
+        //the view references the command line, so it must outlive the read config
+        if constexpr (std::is_same_v<sfun::remove_optional_t<T>, std::string_view>) {
             return data;
         }
+        else if constexpr (std::is_convertible_v<sfun::remove_optional_t<T>, std::string>) {
+            return sfun::remove_optional_t<T>{std::string{data}};
+        }
+        else if constexpr (detail::isCharString<sfun::remove_optional_t<T>>::value) {
+            return sfun::remove_optional_t<T>(data.data(), data.size());
+        }
+        else if constexpr (detail::isCharConvertible_v<sfun::remove_optional_t<T>>) {
+            auto value = sfun::remove_optional_t<T>{};
+            const auto error = detail::fromChars(data, value);
+            if (error == std::errc::result_out_of_range)
+                throw ValidationError{"value is out of range"};
+            if (error != std::errc{})
+                return {};
+            return value;
+        }
         else if constexpr (sfun::is_optional_v<T>) {
             auto value = T{};
             value.emplace();
@@ -69,14 +95,26 @@ std::optional<std::string> convertToString(const T& value)
     }
 }
 
+//StringConverter::fromString can take a std::string_view to read the borrowed command line value without copying,
+//otherwise it's called with a copy of the value
+template<typename T, typename = void>
+struct isStringViewConvertible : std::false_type {};
+
+template<typename T>
+struct isStringViewConvertible<
+        T,
+        std::void_t<decltype(StringConverter<T>::fromString(std::declval<std::string_view>()))>> : std::true_type {};
+
+//returns an empty value if the data can't be converted, the errors thrown by the converter are reported
+//with StringConversionError
 template<typename T>
-T convertFromString(const std::string& data)
+std::optional<T> convertFromString(std::string_view data)
 {
     try {
-        const auto result = StringConverter<T>::fromString(data);
-        if (!result)
-            throw StringConversionError{};
-        return result.value();
+        if constexpr (isStringViewConvertible<T>::value)
+            return StringConverter<T>::fromString(data);
+        else
+            return StringConverter<T>::fromString(std::string{data});
     }
     catch (const ValidationError& error) {
         throw StringConversionError{error.what()};
@@ -1,9 +1,18 @@
 #include "assert_exception.h"
 #include <cmdlime/commandlinereader.h>
 #include <cmdlime/config.h>
+#include <cmdlime/smallvector.h>
 #include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <iterator>
 #include <list>
+#include <memory_resource>
 #include <optional>
+#include <sstream>
+#include <thread>
 
 #if __has_include(<nameof.hpp>)
 #define NAMEOF_AVAILABLE
@@ -108,6 +117,39 @@ struct NonAggregateConfig : public Config,
     CMDLIME_COMMAND(cmd, NonAggregateSubCommandCfg);
 };
 
+struct CountedNestedCommandCfg : public Config {
+    CountedNestedCommandCfg() = default;
+    CountedNestedCommandCfg(cmdlime::detail::CommandLineReaderPtr reader)
+        : Config{reader}
+    {
+        if (reader)
+            ++builtCount;
+    }
+    CMDLIME_PARAM(prm, std::string);
+
+    static inline int builtCount = 0;
+};
+
+struct CountedSubCommandCfg : public Config {
+    CountedSubCommandCfg() = default;
+    CountedSubCommandCfg(cmdlime::detail::CommandLineReaderPtr reader)
+        : Config{reader}
+    {
+        if (reader)
+            ++builtCount;
+    }
+    CMDLIME_PARAM(prm, std::string);
+    CMDLIME_COMMAND(nested, CountedNestedCommandCfg);
+
+    static inline int builtCount = 0;
+};
+
+struct LazyCommandsConfig : public Config {
+    CMDLIME_PARAM(prm, std::optional<std::string>);
+    CMDLIME_COMMAND(first, CountedSubCommandCfg);
+    CMDLIME_COMMAND(second, CountedSubCommandCfg);
+};
+
 TEST(GNUConfig, AllSet)
 {
     auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
@@ -290,6 +332,133 @@ TEST(GNUConfig, AllSetInCommand)
     EXPECT_EQ(cfg.cmd->argumentList, (std::vector<float>{1.1f, 2.2f, 3.3f}));
 }
 
+TEST(GNUConfig, AllSetInCommandFromArgv)
+{
+    auto args = std::vector<std::string>{"app", "cmd", "--required-param=FOO", "--prm-list=zero", "--flg", "4.2", "1.1"};
+    auto argv = std::vector<char*>{};
+    for (auto& arg : args)
+        argv.push_back(arg.data());
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<FullConfig>(static_cast<int>(argv.size()), argv.data());
+    EXPECT_FALSE(cfg.subcommand);
+    ASSERT_TRUE(cfg.cmd);
+    EXPECT_EQ(cfg.cmd->requiredParam, std::string{"FOO"});
+    EXPECT_EQ(cfg.cmd->prmList, (std::vector<std::string>{"zero"}));
+    EXPECT_EQ(cfg.cmd->flg, true);
+    EXPECT_EQ(cfg.cmd->argument, 4.2);
+    EXPECT_EQ(cfg.cmd->argumentList, (std::vector<float>{1.1f}));
+}
+
+struct StringViewConfig : public Config {
+    CMDLIME_PARAM(prm, std::string_view);
+    CMDLIME_PARAM(optionalPrm, std::optional<std::string_view>)();
+    CMDLIME_PARAM(defaultPrm, std::string_view)("default");
+    CMDLIME_PARAMLIST(valueList, std::vector<std::string_view>);
+    CMDLIME_ARG(argument, std::string_view);
+    CMDLIME_ARGLIST(argumentList, std::vector<std::string_view>);
+};
+
+TEST(GNUConfig, StringViewFieldsReferenceArgv)
+{
+    auto args = std::vector<std::string>{"app", "--prm=foo", "-o", "bar", "-v", "a,b", "--value-list", "c", "x", "y z"};
+    auto argv = std::vector<char*>{};
+    for (auto& arg : args)
+        argv.push_back(arg.data());
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<StringViewConfig>(static_cast<int>(argv.size()), argv.data());
+    EXPECT_EQ(cfg.prm, "foo");
+    EXPECT_EQ(cfg.prm.data(), args[1].data() + 6);
+    EXPECT_EQ(cfg.optionalPrm, "bar");
+    EXPECT_EQ(cfg.optionalPrm->data(), args[3].data());
+    EXPECT_EQ(cfg.defaultPrm, "default");
+    EXPECT_EQ(cfg.valueList, (std::vector<std::string_view>{"a", "b", "c"}));
+    EXPECT_EQ(cfg.valueList.at(1).data(), args[5].data() + 2);
+    EXPECT_EQ(cfg.argument, "x");
+    EXPECT_EQ(cfg.argument.data(), args[8].data());
+    EXPECT_EQ(cfg.argumentList, (std::vector<std::string_view>{"y z"}));
+    EXPECT_EQ(cfg.argumentList.at(0).data(), args[9].data());
+}
+
+TEST(GNUConfig, CommandsAreBuiltOnlyWhenRead)
+{
+    CountedSubCommandCfg::builtCount = 0;
+    CountedNestedCommandCfg::builtCount = 0;
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<LazyCommandsConfig>({"--prm", "FOO"});
+    EXPECT_EQ(cfg.prm, "FOO");
+    EXPECT_FALSE(cfg.first);
+    EXPECT_FALSE(cfg.second);
+    EXPECT_EQ(CountedSubCommandCfg::builtCount, 0);
+    EXPECT_EQ(CountedNestedCommandCfg::builtCount, 0);
+
+    cfg = reader.read<LazyCommandsConfig>({"second", "--prm", "BAR"});
+    ASSERT_TRUE(cfg.second);
+    EXPECT_EQ(cfg.second->prm, "BAR");
+    EXPECT_FALSE(cfg.second->nested);
+    EXPECT_EQ(CountedSubCommandCfg::builtCount, 1);
+    EXPECT_EQ(CountedNestedCommandCfg::builtCount, 0);
+
+    reader.compile<LazyCommandsConfig>();
+    EXPECT_EQ(CountedSubCommandCfg::builtCount, 3);
+    EXPECT_EQ(CountedNestedCommandCfg::builtCount, 2);
+    cfg = reader.read<LazyCommandsConfig>({"first", "nested", "--prm", "BAZ"});
+    ASSERT_TRUE(cfg.first);
+    ASSERT_TRUE(cfg.first->nested);
+    EXPECT_EQ(cfg.first->nested->prm, "BAZ");
+    EXPECT_EQ(CountedSubCommandCfg::builtCount, 3);
+    EXPECT_EQ(CountedNestedCommandCfg::builtCount, 2);
+}
+
+TEST(GNUConfig, CopyConfigWithCommand)
+{
+    static_assert(sizeof(cmdlime::optional<SubcommandConfig>) == sizeof(void*));
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<FullConfig>({"cmd", "-r", "FOO", "-L", "zero", "4.2", "1.1"});
+    auto cfgCopy = cfg;
+    ASSERT_TRUE(cfgCopy.cmd);
+    EXPECT_FALSE(cfgCopy.subcommand);
+    EXPECT_NE(&*cfgCopy.cmd, &*cfg.cmd);
+    EXPECT_EQ(cfgCopy.cmd->requiredParam, "FOO");
+    EXPECT_EQ(cfgCopy.cmd->prmList, (std::vector<std::string>{"zero"}));
+
+    cfgCopy.cmd.reset();
+    EXPECT_FALSE(cfgCopy.cmd);
+    ASSERT_TRUE(cfg.cmd);
+    EXPECT_EQ(cfg.cmd->requiredParam, "FOO");
+}
+
+TEST(GNUConfig, CustomNamedCommands)
+{
+    struct Cfg : public Config {
+        CMDLIME_COMMAND(cmd, NestedSubcommandConfig) << cmdlime::Name{"run"};
+        CMDLIME_SUBCOMMAND(subcommand, NestedSubcommandConfig) << cmdlime::Name{"sub"};
+    };
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>({"run", "--prm", "FOO"});
+    ASSERT_TRUE(cfg.cmd);
+    EXPECT_EQ(cfg.cmd->prm, "FOO");
+    EXPECT_FALSE(cfg.subcommand);
+
+    cfg = reader.read<Cfg>({"sub", "--prm", "BAR"});
+    EXPECT_FALSE(cfg.cmd);
+    ASSERT_TRUE(cfg.subcommand);
+    EXPECT_EQ(cfg.subcommand->prm, "BAR");
+
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                reader.read<Cfg>({"cmd", "--prm", "FOO"});
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, std::string{"Encountered unknown positional argument 'cmd'"});
+            });
+}
+
 TEST(GNUConfig, AllSetInCommandWithoutMacro)
 {
     auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
@@ -320,6 +489,92 @@ TEST(GNUConfig, AllSetInCommandWithoutMacro)
     EXPECT_EQ(cfg.cmd->argumentList, (std::vector<float>{1.1f, 2.2f, 3.3f}));
 }
 
+TEST(GNUConfig, CompiledReaderReadsRepeatedly)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.compile<FullConfig>();
+    {
+        auto cfg = reader.read<FullConfig>({"-r", "FOO", "-oBAR", "-L", "zero", "-O", "1,2", "-f", "4.2", "1.1"});
+        EXPECT_EQ(cfg.requiredParam, std::string{"FOO"});
+        EXPECT_EQ(cfg.optionalParam, std::string{"BAR"});
+        EXPECT_EQ(cfg.prmList, (std::vector<std::string>{"zero"}));
+        EXPECT_EQ(cfg.optionalParamList, (std::vector<int>{1, 2}));
+        EXPECT_EQ(cfg.flg, true);
+        EXPECT_EQ(cfg.argument, 4.2);
+        EXPECT_EQ(cfg.argumentList, (std::vector<float>{1.1f}));
+        EXPECT_FALSE(cfg.cmd);
+    }
+    {
+        auto cfg = reader.read<FullConfig>({"-r", "BAZ", "-L", "one", "-L", "two", "2.4", "3.3"});
+        EXPECT_EQ(cfg.requiredParam, std::string{"BAZ"});
+        EXPECT_EQ(cfg.optionalParam, std::string{"defaultValue"});
+        EXPECT_EQ(cfg.prmList, (std::vector<std::string>{"one", "two"}));
+        EXPECT_EQ(cfg.optionalParamList, (std::vector<int>{99, 100}));
+        EXPECT_EQ(cfg.flg, false);
+        EXPECT_EQ(cfg.argument, 2.4);
+        EXPECT_EQ(cfg.argumentList, (std::vector<float>{3.3f}));
+        EXPECT_FALSE(cfg.cmd);
+    }
+    {
+        auto cfg = reader.read<FullConfig>({"cmd", "-r", "FOO", "-L", "zero", "4.2", "1.1"});
+        ASSERT_TRUE(cfg.cmd);
+        EXPECT_EQ(cfg.cmd->requiredParam, std::string{"FOO"});
+        EXPECT_EQ(cfg.cmd->prmList, (std::vector<std::string>{"zero"}));
+        EXPECT_EQ(cfg.cmd->argument, 4.2);
+        EXPECT_EQ(cfg.cmd->argumentList, (std::vector<float>{1.1f}));
+    }
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                reader.read<FullConfig>({"-L", "zero", "4.2", "1.1"});
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, std::string{"Parameter '--required-param' is missing."});
+            });
+}
+
+TEST(GNUConfig, CompiledReaderReadsOtherConfig)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.compile<FullConfig>();
+    auto cfg = reader.read<CommandsConfig>({"cmd", "-r", "FOO", "-L", "zero", "4.2", "1.1"});
+    ASSERT_TRUE(cfg.cmd);
+    EXPECT_EQ(cfg.cmd->requiredParam, std::string{"FOO"});
+
+    auto fullCfg = reader.read<FullConfig>({"-r", "FOO", "-L", "zero", "4.2", "1.1"});
+    EXPECT_EQ(fullCfg.requiredParam, std::string{"FOO"});
+}
+
+TEST(GNUConfig, CompiledReaderReadsConcurrently)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.compile<FullConfig>();
+
+    auto mismatchCounts = std::vector<int>(4);
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < 4; ++i)
+        threads.emplace_back(
+                [&reader, &mismatchCounts, i]
+                {
+                    for (auto j = 0; j < 100; ++j) {
+                        const auto value = std::to_string(i * 100 + j);
+                        auto cfg = reader.read<FullConfig>({"cmd", "-r", value, "-L", value, "4.2", "1.1"});
+                        if (!cfg.cmd || cfg.cmd->requiredParam != value ||
+                            cfg.cmd->prmList != std::vector<std::string>{value})
+                            ++mismatchCounts[i];
+
+                        cfg = reader.read<FullConfig>({"-r", value, "-L", value, "-f", "4.2", "1.1"});
+                        if (cfg.cmd || cfg.requiredParam != value || cfg.prmList != std::vector<std::string>{value} ||
+                            !cfg.flg)
+                            ++mismatchCounts[i];
+                    }
+                });
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(mismatchCounts, (std::vector<int>{0, 0, 0, 0}));
+}
+
 TEST(GNUConfig, CombinedFlagsAndParams)
 {
     struct Cfg : public Config {
@@ -369,6 +624,55 @@ TEST(GNUConfig, CombinedFlagsAndParams)
     }
 }
 
+TEST(GNUConfig, CombinedFlagsAndParamsErrors)
+{
+    struct Cfg : public Config {
+        CMDLIME_FLAG(firstFlag) << cmdlime::ShortName("f");
+        CMDLIME_FLAG(secondFlag) << cmdlime::ShortName("s");
+        CMDLIME_FLAG(thirdFlag) << cmdlime::ShortName("t");
+        CMDLIME_PARAM(prm, std::string)() << cmdlime::ShortName("p");
+    };
+
+    {
+        auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+        auto cfg = reader.read<Cfg>({"-fstpVALUE"});
+        EXPECT_EQ(cfg.firstFlag, true);
+        EXPECT_EQ(cfg.secondFlag, true);
+        EXPECT_EQ(cfg.thirdFlag, true);
+        EXPECT_EQ(cfg.prm, "VALUE");
+    }
+    {
+        auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+        auto cfg = reader.read<Cfg>({"-tpx\xc3\xa9"});
+        EXPECT_EQ(cfg.firstFlag, false);
+        EXPECT_EQ(cfg.thirdFlag, true);
+        EXPECT_EQ(cfg.prm, "x\xc3\xa9");
+    }
+
+    auto expectError = [](const std::vector<std::string>& cmdLine, const std::string& errorMessage)
+    {
+        auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+        assert_exception<cmdlime::ParsingError>(
+                [&]
+                {
+                    reader.read<Cfg>(cmdLine);
+                },
+                [&](const cmdlime::ParsingError& error)
+                {
+                    EXPECT_EQ(std::string{error.what()}, errorMessage);
+                });
+    };
+    expectError({"-fxt"}, "Unknown option 'x' in command '-fxt'");
+    expectError({"-fsx"}, "Unknown option 'x' in command '-fsx'");
+    expectError({"-xft"}, "Encountered unknown parameter or flag '-xft'");
+    //bytes of the non-ASCII characters are looked up one by one
+    expectError({"-f\xc3\xa9"}, "Unknown option '\xc3' in command '-f\xc3\xa9'");
+    expectError({"-f\xfft"}, "Unknown option '\xff' in command '-f\xfft'");
+    expectError({"-f\x7f"}, "Unknown option '\x7f' in command '-f\x7f'");
+    expectError({"-\xc3\xa9"}, "Encountered unknown parameter or flag '-\xc3\xa9'");
+    expectError({"-\xff"}, "Encountered unknown parameter or flag '-\xff'");
+}
+
 TEST(GNUConfig, NumericParamsAndFlags)
 {
     struct Cfg : public Config {
@@ -674,6 +978,123 @@ TEST(GNUConfig, UnexpectedArg)
             });
 }
 
+TEST(GNUConfig, TryRead)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto result = reader.tryRead<FullConfig>({"-r", "FOO", "-i", "9", "-L", "zero", "4.2", "1.1"});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->requiredParam, std::string{"FOO"});
+    EXPECT_EQ(result->optionalIntParam, 9);
+    EXPECT_EQ(result->prmList, (std::vector<std::string>{"zero"}));
+    EXPECT_EQ(result->argument, 4.2);
+    EXPECT_EQ(result->argumentList, (std::vector<float>{1.1f}));
+}
+
+TEST(GNUConfig, TryReadErrors)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    {
+        auto result = reader.tryRead<FullConfig>({"-r", "FOO", "-i", "nine", "-L", "zero", "4.2"});
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().kind(), cmdlime::ReadErrorKind::InvalidValue);
+        EXPECT_EQ(result.error().tokenIndex(), 3u);
+        EXPECT_EQ(result.error().optionName(), std::string{"optional-int-param"});
+        EXPECT_TRUE(result.error().commandName().empty());
+        EXPECT_EQ(
+                result.error().message(),
+                std::string{"Couldn't set parameter '--optional-int-param' value from 'nine'"});
+    }
+    {
+        auto result = reader.tryRead<FullConfig>({"-r", "FOO", "4.2"});
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().kind(), cmdlime::ReadErrorKind::MissingOption);
+        EXPECT_FALSE(result.error().tokenIndex().has_value());
+        EXPECT_EQ(result.error().message(), std::string{"Parameter '--prm-list' is missing."});
+    }
+    {
+        auto result = reader.tryRead<FullConfig>({"cmd", "-r", "FOO", "-L", "zero", "4.2", "1.1", "--foo"});
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().kind(), cmdlime::ReadErrorKind::UnknownOption);
+        EXPECT_EQ(result.error().tokenIndex(), 7u);
+        EXPECT_EQ(result.error().commandName(), std::string{"cmd"});
+        EXPECT_EQ(result.error().message(), std::string{"Encountered unknown parameter or flag '--foo'"});
+    }
+}
+
+TEST(GNUConfig, TryReadCollectingAllErrors)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.setReadErrorMode(cmdlime::ReadErrorMode::CollectAllErrors);
+    auto result = reader.tryRead<FullConfig>({"-i", "nine", "--foo", "-L", "zero", "x", "1.1", "-f", "y"});
+    ASSERT_FALSE(result);
+    auto errors = std::vector<std::pair<std::optional<std::size_t>, std::string>>{};
+    for (const auto& error : result.errors())
+        errors.emplace_back(error.tokenIndex(), error.message());
+    EXPECT_EQ(
+            errors,
+            (std::vector<std::pair<std::optional<std::size_t>, std::string>>{
+                    {1, "Couldn't set parameter '--optional-int-param' value from 'nine'"},
+                    {2, "Encountered unknown parameter or flag '--foo'"},
+                    {5, "Couldn't set argument 'argument' value from 'x'"},
+                    {8, "Couldn't set argument list 'argument-list' element's value from 'y'"},
+                    {std::nullopt, "Parameter '--required-param' is missing."}}));
+}
+
+TEST(GNUConfig, TryReadReturnsConfigError)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAM(prm, std::string) << cmdlime::Name("!param");
+    };
+    struct EmptyNameCfg : public Config {
+        CMDLIME_PARAM(prm, std::string) << cmdlime::Name{""};
+    };
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto result = reader.tryRead<Cfg>({"-pname"});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().kind(), cmdlime::ReadErrorKind::ConfigError);
+    EXPECT_EQ(result.error().message(), std::string{"Parameter's name '!param' must start with an alphabet character"});
+
+    auto emptyNameResult = reader.tryRead<EmptyNameCfg>({"--prm", "name"});
+    ASSERT_FALSE(emptyNameResult);
+    EXPECT_EQ(emptyNameResult.error().kind(), cmdlime::ReadErrorKind::ConfigError);
+    EXPECT_EQ(emptyNameResult.error().message(), std::string{"Custom name can't be empty."});
+}
+
+TEST(GNUConfig, CommandErrorUsageInfoOutlivesReader)
+{
+    auto error = std::optional<cmdlime::CommandParsingError>{};
+    {
+        auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{"testproc"};
+        try {
+            reader.read<FullConfig>({"cmd", "nested", "--foo"});
+        }
+        catch (const cmdlime::CommandParsingError& e) {
+            error = e;
+        }
+    }
+    ASSERT_TRUE(error);
+    EXPECT_EQ(error->commandName(), std::string{"nested"});
+    EXPECT_EQ(std::string{error->what()}, std::string{"Encountered unknown parameter or flag '--foo'"});
+    EXPECT_EQ(error->commandUsageInfo(), std::string{"Usage: testproc cmd nested --prm <string> \n"});
+}
+
+TEST(GNUConfig, ReadErrorOutlivesReader)
+{
+    auto errors = std::vector<cmdlime::ReadError>{};
+    {
+        auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{"testproc"};
+        auto result = reader.tryRead<FullConfig>({"cmd", "nested", "--foo"});
+        ASSERT_FALSE(result);
+        errors = result.errors();
+    }
+    ASSERT_EQ(errors.size(), 1);
+    EXPECT_EQ(errors.front().commandName(), std::string{"nested"});
+    EXPECT_EQ(errors.front().message(), std::string{"Encountered unknown parameter or flag '--foo'"});
+    auto usageInfoRenderer = cmdlime::detail::ReadErrorAccess::commandUsageInfoRenderer(errors.front());
+    ASSERT_TRUE(usageInfoRenderer);
+    EXPECT_EQ(usageInfoRenderer(), std::string{"Usage: testproc cmd nested --prm <string> \n"});
+}
+
 TEST(GNUConfig, WrongParamType)
 {
     {
@@ -720,6 +1141,34 @@ TEST(GNUConfig, WrongParamType)
     }
 }
 
+TEST(GNUConfig, ParamValueOutOfRange)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                auto cfg = reader.read<FullConfig>(
+                        {"-r", "FOO", "-i", "99999999999", "-L", "zero", "-f", "4.2", "1.1", "2.2", "3.3"});
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        std::string{"Couldn't set parameter '--optional-int-param' value from '99999999999': value is "
+                                    "out of range"});
+            });
+}
+
+TEST(GNUConfig, NumbersWithSign)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<FullConfig>({"-r", "FOO", "-i", "+9", "-L", "zero", "-O", "-1", "+4.2", "-1.5e2", "+.5"});
+    EXPECT_EQ(cfg.optionalIntParam, 9);
+    EXPECT_EQ(cfg.optionalParamList, (std::vector<int>{-1}));
+    EXPECT_EQ(cfg.argument, 4.2);
+    EXPECT_EQ(cfg.argumentList, (std::vector<float>{-150.f, 0.5f}));
+}
+
 TEST(GNUConfig, WrongParamListElementType)
 {
     {
@@ -1344,6 +1793,25 @@ TEST(GNUConfig, ConfigErrorRepeatingParamShortNames)
             });
 }
 
+TEST(GNUConfig, ConfigErrorIsReportedOnEachRead)
+{
+    struct TestConfig : public Config {
+        CMDLIME_PARAM(prm, double)();
+        CMDLIME_FLAG(prmFlag) << cmdlime::Name("prm");
+    };
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    for (auto i = 0; i < 2; ++i)
+        assert_exception<cmdlime::ConfigError>(
+                [&]
+                {
+                    reader.read<TestConfig>({});
+                },
+                [](const cmdlime::ConfigError& error)
+                {
+                    EXPECT_EQ(std::string{error.what()}, std::string{"Flag's name 'prm' is already used."});
+                });
+}
+
 TEST(GNUConfig, UsageInfo)
 {
     auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
@@ -1365,6 +1833,92 @@ TEST(GNUConfig, UsageInfoWithoutMacro)
     EXPECT_EQ(reader.usageInfo<FullConfigWithoutMacro>(), expectedInfo);
 }
 
+TEST(GNUConfig, CompiledReaderUsageInfoIsUpdated)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.compile<FullConfig>();
+    reader.setProgramName("testproc");
+    const auto detailedInfo = reader.usageInfoDetailed<FullConfig>();
+    EXPECT_EQ(reader.usageInfoDetailed<FullConfig>(), detailedInfo);
+
+    reader.setProgramName("otherproc");
+    EXPECT_EQ(reader.usageInfo<FullConfig>().rfind("Usage: otherproc [commands] <argument>", 0), 0u);
+
+    auto format = cmdlime::UsageInfoFormat{};
+    format.terminalWidth = 120;
+    reader.setUsageInfoFormat(format);
+    const auto wideDetailedInfo = reader.usageInfoDetailed<FullConfig>();
+    EXPECT_NE(wideDetailedInfo.find("multi-value, optional, default: {99, 100}\n"), std::string::npos);
+    EXPECT_EQ(detailedInfo.find("multi-value, optional, default: {99, 100}\n"), std::string::npos);
+}
+
+TEST(GNUConfig, UsageInfoIsRenderedOnceForRebuiltConfig)
+{
+    using cmdlime::detail::CommandLineReaderAccess;
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.setProgramName("testproc");
+    const auto info = reader.usageInfo<FullConfig>();
+    EXPECT_EQ(reader.usageInfo<FullConfig>(), info);
+    const auto detailedInfo = reader.usageInfoDetailed<FullConfig>();
+    EXPECT_EQ(reader.usageInfoDetailed<FullConfig>(), detailedInfo);
+    EXPECT_EQ(CommandLineReaderAccess::usageInfoRenderCount(reader), 2u);
+
+    auto output = std::stringstream{};
+    reader.setOutputStream(output);
+    auto exec = [&]
+    {
+        return reader.exec<FullConfig>(
+                {"--help"},
+                [](const FullConfig&)
+                {
+                    return 1;
+                });
+    };
+    EXPECT_EQ(exec(), 0);
+    const auto helpOutput = output.str();
+    EXPECT_NE(helpOutput.find("--help"), std::string::npos);
+    EXPECT_EQ(CommandLineReaderAccess::usageInfoRenderCount(reader), 3u);
+    output.str({});
+    EXPECT_EQ(exec(), 0);
+    EXPECT_EQ(output.str(), helpOutput);
+    EXPECT_EQ(CommandLineReaderAccess::usageInfoRenderCount(reader), 3u);
+
+    EXPECT_EQ(reader.usageInfoDetailed<FullConfig>(), detailedInfo);
+    EXPECT_EQ(CommandLineReaderAccess::usageInfoRenderCount(reader), 4u);
+}
+
+std::string runtimeDescription;
+int runtimeDefaultValue;
+
+TEST(GNUConfig, UsageInfoIsRenderedAgainForChangedOptions)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAM(prm, int)(runtimeDefaultValue) << runtimeDescription;
+    };
+
+    using cmdlime::detail::CommandLineReaderAccess;
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.setProgramName("testproc");
+    runtimeDescription = "first";
+    runtimeDefaultValue = 1;
+    EXPECT_EQ(
+            reader.usageInfoDetailed<Cfg>(),
+            std::string{"Usage: testproc [params] \n"
+                        "   -p, --prm <int>     first\n"
+                        "                         (optional, default: 1)\n"});
+    reader.usageInfoDetailed<Cfg>();
+    EXPECT_EQ(CommandLineReaderAccess::usageInfoRenderCount(reader), 1u);
+
+    runtimeDescription = "second";
+    runtimeDefaultValue = 2;
+    EXPECT_EQ(
+            reader.usageInfoDetailed<Cfg>(),
+            std::string{"Usage: testproc [params] \n"
+                        "   -p, --prm <int>     second\n"
+                        "                         (optional, default: 2)\n"});
+    EXPECT_EQ(CommandLineReaderAccess::usageInfoRenderCount(reader), 2u);
+}
+
 TEST(GNUConfig, DetailedUsageInfo)
 {
     auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
@@ -1490,6 +2044,16 @@ struct CustomTypeIntConfig : public Config {
     CMDLIME_ARGLIST(argumentList, std::vector<CustomTypeInt>);
 };
 
+struct CustomTypeView {
+    std::string value;
+};
+
+struct CustomTypeViewConfig : public Config {
+    CMDLIME_PARAM(prm, CustomTypeView);
+    CMDLIME_PARAMLIST(prmList, std::vector<CustomTypeView>) << cmdlime::ShortName{"l"};
+    CMDLIME_ARG(argument, CustomTypeView);
+};
+
 TEST(GNUConfig, CustomTypeUsage)
 {
     auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
@@ -1639,6 +2203,491 @@ TEST(GNUConfig, CustomTypeIntError)
             });
 }
 
+TEST(GNUConfig, CustomTypeFromStringView)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<CustomTypeViewConfig>({"--prm=hello", "-l", "foo,bar", "test arg"});
+    EXPECT_EQ(cfg.prm.value, "hello");
+    ASSERT_EQ(cfg.prmList.size(), 2);
+    EXPECT_EQ(cfg.prmList.at(0).value, "foo");
+    EXPECT_EQ(cfg.prmList.at(1).value, "bar");
+    EXPECT_EQ(cfg.argument.value, "test arg");
+}
+
+TEST(GNUConfig, ParamListDelimiter)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(ids, std::vector<int>);
+        CMDLIME_PARAMLIST(names, std::deque<std::string>) << cmdlime::Delimiter{"::"};
+        CMDLIME_PARAMLIST(paths, std::vector<std::string>)() << cmdlime::Delimiter{";"};
+    };
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>(
+            {"--ids", "1,2,,3", "-i", "4", "--names", "a::b,c::", "-n", "d", "--paths", "/usr/bin;/opt/a,b"});
+    EXPECT_EQ(cfg.ids, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(cfg.names, (std::deque<std::string>{"a", "b,c", "d"}));
+    EXPECT_EQ(cfg.paths, (std::vector<std::string>{"/usr/bin", "/opt/a,b"}));
+
+    cfg = reader.read<Cfg>({"--ids", "1, 2,  ,3 ", "--names", " a:: b ::  ", "--paths", "/usr/bin; /opt/a b"});
+    EXPECT_EQ(cfg.ids, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(cfg.names, (std::deque<std::string>{"a", "b"}));
+    EXPECT_EQ(cfg.paths, (std::vector<std::string>{"/usr/bin", "/opt/a b"}));
+
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                reader.read<Cfg>({"--ids", "1,2;3", "--names", "a"});
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, std::string{"Couldn't set parameter '--ids' value from '1,2;3'"});
+            });
+}
+
+TEST(GNUConfig, LargeParamList)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(ids, std::vector<std::uint64_t>);
+    };
+
+    auto expectedIds = std::vector<std::uint64_t>{};
+    auto idsValue = std::string{};
+    for (auto i = std::uint64_t{0}; i < 50000; ++i) {
+        expectedIds.push_back(i * 1000003);
+        idsValue += (i ? "," : "") + std::to_string(i * 1000003);
+    }
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>({"--ids", idsValue});
+    EXPECT_EQ(cfg.ids, expectedIds);
+}
+
+TEST(GNUConfig, ArrayParamList)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(rgb, std::array<int, 3>);
+        CMDLIME_PARAMLIST(bounds, std::array<double, 4>)(std::array<double, 4>{0, 0, 1, 1});
+    };
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.setProgramName("testproc");
+    auto cfg = reader.read<Cfg>({"--rgb", "1,2", "-r", "3"});
+    EXPECT_EQ(cfg.rgb, (std::array<int, 3>{1, 2, 3}));
+    EXPECT_EQ(cfg.bounds, (std::array<double, 4>{0, 0, 1, 1}));
+
+    cfg = reader.read<Cfg>({"--rgb", "4,5,6", "--bounds", "1.5,2,3,4"});
+    EXPECT_EQ(cfg.rgb, (std::array<int, 3>{4, 5, 6}));
+    EXPECT_EQ(cfg.bounds, (std::array<double, 4>{1.5, 2, 3, 4}));
+
+    auto result = reader.tryRead<Cfg>({"--rgb", "1,2,3", "--bounds", "1,2,3,4,5"});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().message(), "Parameter '--bounds' must have exactly 4 values");
+    EXPECT_EQ(result.error().tokenIndex(), 3);
+
+    result = reader.tryRead<Cfg>({"--rgb", "1,2"});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().message(), "Parameter '--rgb' must have exactly 3 values");
+    EXPECT_EQ(result.error().tokenIndex(), std::nullopt);
+
+    EXPECT_EQ(reader.usageInfo<Cfg>(), "Usage: testproc --rgb <int>... [--bounds <double>...] \n");
+}
+
+TEST(GNUConfig, SmallVectorLists)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(ids, cmdlime::SmallVector<int, 2>);
+        CMDLIME_ARGLIST(files, cmdlime::SmallVector<std::string, 2>);
+    };
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>({"--ids", "1,2", "a"});
+    EXPECT_EQ(cfg.ids, (cmdlime::SmallVector<int, 2>{1, 2}));
+    EXPECT_FALSE(cfg.ids.isOnHeap());
+    EXPECT_EQ(cfg.files, (cmdlime::SmallVector<std::string, 2>{"a"}));
+
+    cfg = reader.read<Cfg>({"--ids", "1,2", "--ids", "3", "a", "b", "c"});
+    EXPECT_EQ(cfg.ids, (cmdlime::SmallVector<int, 2>{1, 2, 3}));
+    EXPECT_TRUE(cfg.ids.isOnHeap());
+    EXPECT_EQ(cfg.files, (cmdlime::SmallVector<std::string, 2>{"a", "b", "c"}));
+}
+
+TEST(GNUConfig, SmallVectorSpillsToHeap)
+{
+    auto values = cmdlime::SmallVector<std::string, 2>{"first value longer than the small string buffer", "second"};
+    values.push_back(values[0]);
+    ASSERT_TRUE(values.isOnHeap());
+    EXPECT_EQ(
+            values,
+            (cmdlime::SmallVector<std::string, 2>{
+                    "first value longer than the small string buffer",
+                    "second",
+                    "first value longer than the small string buffer"}));
+
+    auto copy = values;
+    auto moved = std::move(values);
+    EXPECT_EQ(moved, copy);
+    EXPECT_TRUE(values.empty());
+
+    struct Element {
+        explicit Element(int value)
+            : value{value}
+        {
+        }
+        int value;
+    };
+    auto elements = cmdlime::SmallVector<Element, 1>{};
+    elements.emplace_back(1);
+    elements.emplace_back(elements.front().value + 1);
+    ASSERT_EQ(elements.size(), 2);
+    EXPECT_EQ(elements[0].value, 1);
+    EXPECT_EQ(elements[1].value, 2);
+}
+
+struct PmrCommandConfig : public Config {
+    CMDLIME_PARAM(message, std::pmr::string);
+};
+
+struct PmrConfig : public Config {
+    CMDLIME_PARAM(name, std::pmr::string);
+    CMDLIME_PARAMLIST(tags, std::pmr::vector<std::pmr::string>)();
+    CMDLIME_ARGLIST(files, std::pmr::vector<std::pmr::string>);
+    CMDLIME_SUBCOMMAND(commit, PmrCommandConfig);
+};
+
+TEST(GNUConfig, MemoryResource)
+{
+    const auto longValue = std::string(64, 'x');
+    auto arena = std::pmr::monotonic_buffer_resource{};
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<PmrConfig>(
+            {"--name", longValue, "--tags", "a,b", "one", "two", "commit", "-m", longValue},
+            arena);
+    EXPECT_EQ(std::string_view{cfg.name}, longValue);
+    EXPECT_EQ(cfg.name.get_allocator().resource(), &arena);
+    EXPECT_EQ(cfg.tags, (std::pmr::vector<std::pmr::string>{"a", "b"}));
+    EXPECT_EQ(cfg.tags.get_allocator().resource(), &arena);
+    EXPECT_EQ(cfg.tags.front().get_allocator().resource(), &arena);
+    EXPECT_EQ(cfg.files, (std::pmr::vector<std::pmr::string>{"one", "two"}));
+    EXPECT_EQ(cfg.files.get_allocator().resource(), &arena);
+    ASSERT_TRUE(cfg.commit.has_value());
+    EXPECT_EQ(std::string_view{cfg.commit->message}, longValue);
+    EXPECT_EQ(cfg.commit->message.get_allocator().resource(), &arena);
+
+    reader.compile<PmrConfig>();
+    auto compiledCfg = reader.tryRead<PmrConfig>({"--name", "value with spaces", "file"}, arena);
+    ASSERT_TRUE(compiledCfg);
+    EXPECT_EQ(compiledCfg->name, "value with spaces");
+    EXPECT_EQ(compiledCfg->name.get_allocator().resource(), &arena);
+    EXPECT_EQ(compiledCfg->tags.get_allocator().resource(), &arena);
+
+    auto defaultCfg = reader.read<PmrConfig>({"--name", longValue, "file"});
+    EXPECT_EQ(std::string_view{defaultCfg.name}, longValue);
+    EXPECT_EQ(defaultCfg.name.get_allocator().resource(), std::pmr::get_default_resource());
+}
+
+//memory resource that can be used only by the thread that created it
+class SingleThreadMemoryResource : public std::pmr::memory_resource {
+public:
+    bool isUsedFromOtherThreads() const
+    {
+        return isUsedFromOtherThreads_;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        checkThread();
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+    {
+        checkThread();
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    void checkThread()
+    {
+        if (std::this_thread::get_id() != ownerThreadId_)
+            isUsedFromOtherThreads_ = true;
+    }
+
+private:
+    std::thread::id ownerThreadId_ = std::this_thread::get_id();
+    std::atomic<bool> isUsedFromOtherThreads_ = false;
+};
+
+TEST(GNUConfig, MemoryResourceWithParallelConversion)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(names, std::pmr::vector<std::pmr::string>) << cmdlime::ParallelConversion{4};
+        CMDLIME_ARGLIST(files, std::pmr::vector<std::pmr::string>) << cmdlime::ParallelConversion{4};
+    };
+
+    auto namesValue = std::string{};
+    auto expectedNames = std::vector<std::string>{};
+    auto cmdLine = std::vector<std::string>{"--names", ""};
+    for (auto i = 0; i < 4000; ++i) {
+        auto value = std::string(32, 'a') + std::to_string(i);
+        namesValue += value + ",";
+        expectedNames.push_back(value);
+        cmdLine.push_back(value);
+    }
+    cmdLine[1] = namesValue;
+
+    auto resource = SingleThreadMemoryResource{};
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>(cmdLine, resource);
+    EXPECT_FALSE(resource.isUsedFromOtherThreads());
+    EXPECT_EQ(std::vector<std::string>(cfg.names.begin(), cfg.names.end()), expectedNames);
+    EXPECT_EQ(std::vector<std::string>(cfg.files.begin(), cfg.files.end()), expectedNames);
+    EXPECT_EQ(cfg.names.back().get_allocator().resource(), &resource);
+    EXPECT_EQ(cfg.files.back().get_allocator().resource(), &resource);
+}
+
+TEST(GNUConfig, CompiledReaderWithMemoryResourcePerThread)
+{
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.compile<PmrConfig>();
+
+    auto failedReadCount = std::atomic<int>{};
+    auto readInThread = [&](const std::string& name)
+    {
+        auto resource = SingleThreadMemoryResource{};
+        const auto longName = name + std::string(32, 'x');
+        for (auto i = 0; i < 100; ++i) {
+            auto cfg = reader.read<PmrConfig>(
+                    {"--name", longName, "--tags", longName, longName, "commit", "-m", name},
+                    resource);
+            const auto isReadCorrectly = std::string_view{cfg.name} == longName &&
+                    std::string_view{cfg.tags.front()} == longName && std::string_view{cfg.files.front()} == longName &&
+                    std::string_view{cfg.commit->message} == name;
+            const auto usesResource = cfg.name.get_allocator().resource() == &resource &&
+                    cfg.commit->message.get_allocator().resource() == &resource;
+            if (!isReadCorrectly || !usesResource || resource.isUsedFromOtherThreads())
+                ++failedReadCount;
+        }
+    };
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < 4; ++i)
+        threads.emplace_back(readInThread, "thread" + std::to_string(i));
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(failedReadCount, 0);
+}
+
+std::vector<std::string> streamedFiles;
+std::vector<int> streamedNumbers;
+
+TEST(GNUConfig, ArgListSink)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAM(prm, std::string);
+        CMDLIME_ARGLIST(files, cmdlime::ArgListSink<std::string>) << [](std::string file)
+        {
+            streamedFiles.push_back(std::move(file));
+        };
+    };
+
+    streamedFiles.clear();
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>({"a.txt", "--prm", "x", "b.txt", "c.txt"});
+    EXPECT_EQ(cfg.prm, "x");
+    EXPECT_EQ(cfg.files.size(), 3);
+    EXPECT_EQ(streamedFiles, (std::vector<std::string>{"a.txt", "b.txt", "c.txt"}));
+
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                reader.read<Cfg>({"--prm", "x"});
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, std::string{"Arguments list 'files' is missing."});
+            });
+}
+
+TEST(GNUConfig, ArgListSinkHandlerError)
+{
+    struct Cfg : public Config {
+        CMDLIME_ARGLIST(files, cmdlime::ArgListSink<std::string>) << [](std::string file)
+        {
+            if (file.empty() || file.front() == '.')
+                throw cmdlime::ValidationError{"hidden files aren't allowed"};
+            if (file == "x")
+                throw std::runtime_error{"unexpected"};
+            streamedFiles.push_back(std::move(file));
+        };
+    };
+
+    streamedFiles.clear();
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto result = reader.tryRead<Cfg>({"a.txt", ".b.txt", "c.txt"});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().kind(), cmdlime::ReadErrorKind::InvalidValue);
+    EXPECT_EQ(result.error().tokenIndex(), 1);
+    EXPECT_EQ(
+            result.error().message(),
+            "Couldn't set argument list 'files' element's value from '.b.txt': hidden files aren't allowed");
+    EXPECT_EQ(streamedFiles, (std::vector<std::string>{"a.txt"}));
+
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                reader.read<Cfg>({"a.txt", "x"});
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        std::string{"Couldn't set argument list 'files' element's value from 'x'"});
+            });
+}
+
+TEST(GNUConfig, OptionalArgListSinkWithOutputIterator)
+{
+    struct Cfg : public Config {
+        CMDLIME_ARGLIST(numbers, cmdlime::ArgListSink<int>)() << std::back_inserter(streamedNumbers);
+    };
+
+    streamedNumbers.clear();
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    reader.setProgramName("testproc");
+    auto cfg = reader.read<Cfg>({});
+    EXPECT_TRUE(cfg.numbers.empty());
+
+    cfg = reader.read<Cfg>({"1", "2", "3"});
+    EXPECT_EQ(cfg.numbers.size(), 3);
+    EXPECT_EQ(streamedNumbers, (std::vector<int>{1, 2, 3}));
+
+    streamedNumbers.clear();
+    auto result = reader.tryRead<Cfg>({"4", "x", "5"});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().message(), "Couldn't set argument list 'numbers' element's value from 'x'");
+    EXPECT_EQ(result.error().tokenIndex(), 1);
+    EXPECT_EQ(streamedNumbers, (std::vector<int>{4}));
+
+    streamedNumbers.clear();
+    reader.setReadErrorMode(cmdlime::ReadErrorMode::CollectAllErrors);
+    result = reader.tryRead<Cfg>({"x", "6", "y"});
+    ASSERT_EQ(result.errors().size(), 2);
+    EXPECT_EQ(result.errors().at(0).tokenIndex(), 0);
+    EXPECT_EQ(result.errors().at(1).tokenIndex(), 2);
+    EXPECT_EQ(streamedNumbers, (std::vector<int>{6}));
+    reader.setReadErrorMode(cmdlime::ReadErrorMode::StopOnFirstError);
+
+    auto expectedInfo = std::string{"Usage: testproc [numbers...]\n"
+                                    "Arguments:\n"
+                                    "    <numbers> (int)     multi-value, optional\n"};
+    EXPECT_EQ(reader.usageInfoDetailed<Cfg>(), expectedInfo);
+}
+
+TEST(GNUConfig, ListParallelConversion)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(ids, std::vector<int>) << cmdlime::ParallelConversion{4};
+        CMDLIME_ARGLIST(values, std::deque<double>) << cmdlime::ParallelConversion{};
+    };
+
+    auto expectedIds = std::vector<int>{};
+    auto idsValue = std::string{};
+    auto expectedValues = std::deque<double>{};
+    auto cmdLine = std::vector<std::string>{"--ids", "", "-i", "-1"};
+    for (auto i = 0; i < 10000; ++i) {
+        expectedIds.push_back(i);
+        idsValue += std::to_string(i) + ",";
+        expectedValues.push_back(i / 2.0);
+        cmdLine.push_back(std::to_string(i / 2.0));
+    }
+    cmdLine[1] = idsValue;
+    expectedIds.push_back(-1);
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto cfg = reader.read<Cfg>(cmdLine);
+    EXPECT_EQ(cfg.ids, expectedIds);
+    EXPECT_EQ(cfg.values, expectedValues);
+
+    cmdLine[3] = "-1x";
+    assert_exception<cmdlime::ParsingError>(
+            [&]
+            {
+                reader.read<Cfg>(cmdLine);
+            },
+            [](const cmdlime::ParsingError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, std::string{"Couldn't set parameter '--ids' value from '-1x'"});
+            });
+}
+
+TEST(GNUConfig, ParamListParallelConversionErrorDetails)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAMLIST(names, std::vector<CustomType>) << cmdlime::ParallelConversion{4};
+        CMDLIME_PARAMLIST(values, std::vector<CustomType>)();
+    };
+
+    auto namesValue = std::string{"a"};
+    for (auto i = 0; i < 2000; ++i)
+        namesValue += ",a";
+    namesValue += ",b1";
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto result = reader.tryRead<Cfg>({"--names", namesValue});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().kind(), cmdlime::ReadErrorKind::InvalidValue);
+    EXPECT_EQ(result.error().tokenIndex(), 1);
+    EXPECT_EQ(
+            result.error().message(),
+            "Couldn't set parameter '--names' value from '" + namesValue + "': CustomType can't contain digits");
+
+    result = reader.tryRead<Cfg>({"--names", "a", "--values", "a,b1"});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(
+            result.error().message(),
+            std::string{"Couldn't set parameter '--values' value from 'a,b1': CustomType can't contain digits"});
+}
+
+TEST(GNUConfig, ListParallelConversionErrorsInTokenOrder)
+{
+    struct Cfg : public Config {
+        CMDLIME_PARAM(prm, int)();
+        CMDLIME_ARGLIST(values, std::vector<int>) << cmdlime::ParallelConversion{4};
+    };
+
+    auto cmdLine = std::vector<std::string>{};
+    for (auto i = 0; i < 5000; ++i)
+        cmdLine.push_back(std::to_string(i));
+    cmdLine[4000] = "x";
+    cmdLine[1000] = "y";
+    cmdLine.insert(cmdLine.begin() + 2000, {"--prm", "z"});
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::GNU>{};
+    auto result = reader.tryRead<Cfg>(cmdLine);
+    ASSERT_FALSE(result);
+    ASSERT_EQ(result.errors().size(), 1);
+    EXPECT_EQ(result.error().tokenIndex(), 1000);
+    EXPECT_EQ(result.error().message(), "Couldn't set argument list 'values' element's value from 'y'");
+
+    reader.setReadErrorMode(cmdlime::ReadErrorMode::CollectAllErrors);
+    result = reader.tryRead<Cfg>(cmdLine);
+    ASSERT_FALSE(result);
+    auto errors = std::vector<std::pair<std::optional<std::size_t>, std::string>>{};
+    for (const auto& error : result.errors())
+        errors.emplace_back(error.tokenIndex(), error.message());
+    EXPECT_EQ(
+            errors,
+            (std::vector<std::pair<std::optional<std::size_t>, std::string>>{
+                    {1000, "Couldn't set argument list 'values' element's value from 'y'"},
+                    {2001, "Couldn't set parameter '--prm' value from 'z'"},
+                    {4002, "Couldn't set argument list 'values' element's value from 'x'"}}));
+}
+
 } //namespace test_gnu_format
 
 namespace cmdlime {
@@ -1680,4 +2729,22 @@ struct StringConverter<test_gnu_format::CustomTypeInt> {
         return val;
     }
 };
+
+template<>
+struct StringConverter<test_gnu_format::CustomTypeView> {
+    static std::string toString(const test_gnu_format::CustomTypeView& val)
+    {
+        return val.value;
+    }
+
+    static std::optional<test_gnu_format::CustomTypeView> fromString(std::string_view str)
+    {
+        return test_gnu_format::CustomTypeView{std::string{str}};
+    }
+
+    static std::optional<test_gnu_format::CustomTypeView> fromString(const std::string&)
+    {
+        throw ValidationError{"the value must be passed as std::string_view"};
+    }
+};
 } //namespace cmdlime
\ No newline at end of file
@@ -153,6 +153,55 @@ TEST(PosixConfig, CombinedFlagsAndParams)
     }
 }
 
+TEST(PosixConfig, CombinedFlagsAndParamsErrors)
+{
+    struct Cfg : public Config {
+        CMDLIME_FLAG(firstFlag);
+        CMDLIME_FLAG(secondFlag);
+        CMDLIME_FLAG(thirdFlag);
+        CMDLIME_PARAM(prm, std::string)();
+    };
+
+    {
+        auto reader = cmdlime::POSIXCommandLineReader{};
+        auto cfg = reader.read<Cfg>({"-fstpVALUE"});
+        EXPECT_EQ(cfg.firstFlag, true);
+        EXPECT_EQ(cfg.secondFlag, true);
+        EXPECT_EQ(cfg.thirdFlag, true);
+        EXPECT_EQ(cfg.prm, "VALUE");
+    }
+    {
+        auto reader = cmdlime::POSIXCommandLineReader{};
+        auto cfg = reader.read<Cfg>({"-tpx\xc3\xa9"});
+        EXPECT_EQ(cfg.firstFlag, false);
+        EXPECT_EQ(cfg.thirdFlag, true);
+        EXPECT_EQ(cfg.prm, "x\xc3\xa9");
+    }
+
+    auto expectError = [](const std::vector<std::string>& cmdLine, const std::string& errorMessage)
+    {
+        auto reader = cmdlime::POSIXCommandLineReader{};
+        assert_exception<cmdlime::ParsingError>(
+                [&]
+                {
+                    reader.read<Cfg>(cmdLine);
+                },
+                [&](const cmdlime::ParsingError& error)
+                {
+                    EXPECT_EQ(std::string{error.what()}, errorMessage);
+                });
+    };
+    expectError({"-fxt"}, "Unknown option 'x' in command '-fxt'");
+    expectError({"-fsx"}, "Unknown option 'x' in command '-fsx'");
+    expectError({"-xft"}, "Encountered unknown parameter or flag '-xft'");
+    //bytes of the non-ASCII characters are looked up one by one
+    expectError({"-f\xc3\xa9"}, "Unknown option '\xc3' in command '-f\xc3\xa9'");
+    expectError({"-f\xfft"}, "Unknown option '\xff' in command '-f\xfft'");
+    expectError({"-f\x7f"}, "Unknown option '\x7f' in command '-f\x7f'");
+    expectError({"-\xc3\xa9"}, "Encountered unknown parameter or flag '-\xc3\xa9'");
+    expectError({"-\xff"}, "Encountered unknown parameter or flag '-\xff'");
+}
+
 TEST(PosixConfig, NumericParamsAndFlags)
 {
     struct Cfg : public Config {
@@ -995,6 +995,33 @@ TEST(SimpleConfig, DetailedUsageInfoFormat)
     EXPECT_EQ(reader.usageInfoDetailed<FullConfig>(), expectedDetailedInfo);
 }
 
+TEST(SimpleConfig, DetailedUsageInfoLongDescription)
+{
+    struct TestConfig : public Config {
+        CMDLIME_PARAM(mode, std::string)
+                << "processing mode, one of:\n"
+                   "fast - skips the verification of the processed data,\n"
+                   "safe - verifies every processed chunk with checksum_of_the_whole_chunk_and_its_header";
+    };
+
+    auto reader = cmdlime::CommandLineReader<cmdlime::Format::Simple>{};
+    reader.setProgramName("testproc");
+    auto format = cmdlime::UsageInfoFormat{};
+    format.terminalWidth = 50;
+    reader.setUsageInfoFormat(format);
+    auto expectedDetailedInfo = std::string{"Usage: testproc -mode=<string> \n"
+                                            "Parameters:\n"
+                                            "   -mode=<string>     processing mode, one of:\n"
+                                            "                        fast - skips the \n"
+                                            "                        verification of the \n"
+                                            "                        processed data,\n"
+                                            "                        safe - verifies every \n"
+                                            "                        processed chunk with \n"
+                                            "                        checksum_of_the_whole_chun\n"
+                                            "                        k_and_its_header\n"};
+    EXPECT_EQ(reader.usageInfoDetailed<TestConfig>(), expectedDetailedInfo);
+}
+
 TEST(SimpleConfig, CustomValueNames)
 {
     struct TestConfig : public Config {